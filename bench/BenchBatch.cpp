@@ -0,0 +1,78 @@
+/** @file
+    Host benchmark: InterpolatedLookup1D::rawBatch() against the scalar
+    raw() loop for TempTable100kB3950x128.
+
+    Build (from the repo root):
+        g++ -O2 -march=native -Isrc bench/BenchBatch.cpp src/TempTable100kB3950x128.cpp -o benchBatch
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "TempTable100kB3950x128.h"
+
+typedef std::chrono::steady_clock Clock;
+
+//-----------------------------------------------
+static double seconds(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+//-----------------------------------------------
+int main()
+{
+    const auto& tab = TempTable100kB3950x128::_instance;
+
+    //
+    // exhaustive check first; every uint16_t count, odd length so the tail runs
+    std::vector<uint16_t> all(65535);
+    for (size_t i = 0; i < all.size(); ++i)
+        all[i] = (uint16_t)i;
+
+    std::vector<int16_t> got(all.size());
+    tab.rawBatch(all.data(), got.data(), all.size());
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        if (got[i] != tab.raw(all[i]))
+        {
+            printf("MISMATCH count=%u batch=%d raw=%d\n", all[i], got[i], tab.raw(all[i]));
+            return 1;
+        }
+    }
+    printf("rawBatch matches raw() for all counts\n");
+
+    //
+    // realistic 10 bit ADC data
+    const size_t N = 1 << 20;
+    const int REPS = 50;
+    std::vector<uint16_t> counts(N);
+    srand(1);
+    for (size_t i = 0; i < N; ++i)
+        counts[i] = rand() & 1023;
+    std::vector<int16_t> out(N);
+
+    long sum = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+    {
+        for (size_t i = 0; i < N; ++i)
+            out[i] = tab.raw(counts[i]);
+        sum += out[r];
+    }
+    double ts = seconds(t0);
+
+    t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+    {
+        tab.rawBatch(counts.data(), out.data(), N);
+        sum += out[r];
+    }
+    double tb = seconds(t0);
+
+    double ops = double(N) * REPS;
+    printf("scalar raw()  %8.1f Mcounts/s\n", ops / ts / 1e6);
+    printf("rawBatch()    %8.1f Mcounts/s  (x%.2f)\n", ops / tb / 1e6, ts / tb);
+    printf("(checksum %ld)\n", sum);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/** @file
+    Host benchmark: run time table build (ThermistorTableBuilder) for a
+    100k/3950 thermistor with a 100k load; cost of a full build and of one
+    incremental step, and the largest difference from the generated
+    TempTable100kB3950x128.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchBuilder.cpp src/Thermistor.cpp src/TempTable100kB3950x128.cpp -o benchBuilder
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ThermistorTableBuilder.h"
+#include "TempTable100kB3950x128.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int REPS = 20000;
+
+//-----------------------------------------------
+int main()
+{
+    Thermistor cal;
+    cal._rl = 100000;
+    cal._vAdcMax = 3.3;
+    cal._vDrive = 3.3;
+
+    ThermistorTableBuilder<10, 5> builder(128);
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        builder.build(cal);
+    double build = std::chrono::duration<double>(Clock::now() - t0).count() / REPS * 1e9;
+
+    // incremental, interleaved with lookups as a sampling loop would
+    long sum = 0;
+    int steps = 0;
+    t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+    {
+        builder.begin(cal);
+        while (!builder.step())
+        {
+            sum += builder.lookup().raw(r & 1023);
+            ++steps;
+        }
+        ++steps;
+    }
+    double step = std::chrono::duration<double>(Clock::now() - t0).count() / steps * 1e9;
+
+    int maxDiff = 0;
+    for (uint16_t c = 0; c < 1024; ++c)
+    {
+        int d = abs(builder.lookup().raw(c) - TempTable100kB3950x128::_instance.raw(c));
+        if (d > maxDiff)
+            maxDiff = d;
+    }
+
+    printf("full build %.0f ns, step (one entry + one lookup) %.1f ns\n", build, step);
+    printf("max |difference| from TempTable100kB3950x128: %d raw (%.4fC)\n", maxDiff, maxDiff / 128.0);
+    printf("(checksum %ld)\n", sum);
+    return 0;
+}
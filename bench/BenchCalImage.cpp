@@ -0,0 +1,126 @@
+/** @file
+    Host benchmark: calibration image with 10k HS1101 profiles (each
+    sensor's humidity table offset a little) plus a thermistor table.
+    Times mapping the file, attaching every profile with and without its
+    crc check, and verify(); checks mapped conversions against the
+    compiled in tables, with sensor 2 provisioned twice (the second
+    replaces the first), and that a table with no profile is refused.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchCalImage.cpp src/CalImage.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp src/TempTable100kB3950x128.cpp -o benchCalImage
+    Run: ./benchCalImage [image path]
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "CalImage.h"
+#include "HS1101Mapped.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "TempTable100kB3950x128.h"
+
+typedef std::chrono::steady_clock Clock;
+typedef HS1101Rt100k0Rs100k0Tl_10Th110Data Data;
+typedef HS1101MappedData<Data> Mapped;
+
+static const uint32_t SENSORS = 10000;
+static const uint32_t THERM_ID = 0xffffffff;
+
+//-----------------------------------------------
+static double ms(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count() * 1e3;
+}
+//-----------------------------------------------
+/// The compiled in tables are protected; a derived class can read them
+struct Compiled : Data
+{
+    static const int16_t* humid() { return &_hs1101_table[0][0]; }
+};
+//-----------------------------------------------
+/// Compiled in humidity table, every entry moved by delta
+static void offsetTable(int16_t* out, int delta)
+{
+    for (int i = 0; i < Data::_humid_table_sizeT * Data::_humid_table_sizeH; ++i)
+        out[i] = Compiled::humid()[i] + delta;
+}
+//-----------------------------------------------
+int main(int argc, char** argv)
+{
+    const char* path = argc > 1 ? argv[1] : "/tmp/psi_cal.bin";
+
+    // sensors in no particular order; build() sorts them
+    static int16_t humid[Data::_humid_table_sizeT * Data::_humid_table_sizeH];
+    CalImageWriter w;
+    bool orphan = w.addTable(CalRole::Thermistor, 128, CalAxis{ 0, 1024, 32 }, 32, humid);
+    auto t0 = Clock::now();
+    offsetTable(humid, 9);      // stale; provisioned again in the loop
+    Mapped::write(w, 2, nullptr, humid);
+    for (uint32_t i = 0; i < SENSORS; ++i)
+    {
+        uint32_t id = (i * 7919) % SENSORS;
+        offsetTable(humid, int(id % 5) - 2);
+        Mapped::write(w, id, nullptr, humid);
+    }
+    const auto& tt = TempTable100kB3950x128::_instance;
+    w.addProfile(THERM_ID);
+    w.addTable(CalRole::Thermistor, 128, CalAxis{ 0, 1024, 32 }, 32, tt.table());
+    if (!w.save(path))
+    {
+        printf("can't write %s\n", path);
+        return 1;
+    }
+    printf("wrote %u profiles to %s in %.1f ms\n", SENSORS + 1, path, ms(t0));
+
+    t0 = Clock::now();
+    CalImageFile image;
+    CalImage::Status s = image.open(path);
+    printf("open          %8.3f ms  status %d, %u profiles\n", ms(t0), int(s), image.count());
+    if (s != CalImage::Status::Ok)
+        return 1;
+
+    static HS1101Mapped<Data> sensors[SENSORS];
+    for (int check = 0; check < 2; ++check)
+    {
+        t0 = Clock::now();
+        uint32_t attached = 0;
+        for (uint32_t id = 0; id < SENSORS; ++id)
+        {
+            const CalProfile* p = image.find(id, check);
+            attached += p && sensors[id].attach(*p);
+        }
+        printf("attach %s %8.3f ms  %u attached\n", check ? "(crc)" : "     ", ms(t0), attached);
+    }
+
+    t0 = Clock::now();
+    s = image.verify();
+    printf("verify        %8.3f ms  status %d\n", ms(t0), int(s));
+
+    // id 2 has no offset, so it must match the compiled in tables exactly
+    HS1101Rt100k0Rs100k0Tl_10Th110 compiled;
+    int mismatches = 0, offsetWrong = 0;
+    for (uint16_t adc = 0; adc < 1024; ++adc)
+        mismatches += sensors[2].rawTemp(adc) != compiled.rawTemp(adc);
+    for (uint16_t c = 8400; c < 10900; c += 3)
+        for (int16_t t = -1400; t < 14100; t += 97)
+        {
+            int16_t a, b, d;
+            compiled.computeRH(c, t, a);
+            sensors[2].computeRH(c, t, b);
+            sensors[4].computeRH(c, t, d);
+            mismatches += a != b;
+            offsetWrong += b > 0 && b < Data::_humid_max_raw - 8 && d != b + 2;
+        }
+
+    const CalProfile* tp = image.find(THERM_ID);
+    const CalTable* t = tp ? CalImage::table(*tp, CalRole::Thermistor) : nullptr;
+    if (!t)
+        return 1;
+    InterpolatedLookup1DBits<int16_t, float, 10, 5, InterpolatedLookup1DStatic> mapped(CalImage::values(*tp, *t), t->scale);
+    for (uint16_t adc = 0; adc < 1024; ++adc)
+        mismatches += mapped.raw(adc) != tt.raw(adc);
+
+    printf("mismatches %d, offset profile wrong %d%s\n", mismatches, offsetWrong,
+        orphan ? ", table with no profile taken" : "");
+    return mismatches || offsetWrong || orphan || image.count() != SENSORS + 1;
+}
@@ -0,0 +1,87 @@
+/** @file
+    Host benchmark: direct (one entry per count) against interpolated
+    thermistor lookup for 100k/3950 x128 on a 10 bit ADC; time per
+    lookup, table bytes, and error against the double Beta equation.
+    Also checks the compile-time tables against the generated
+    TempTable100kB3950x128/x100 for every count; exits 1 on a mismatch.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchDirect.cpp src/TempTable100kB3950x100.cpp src/TempTable100kB3950x128.cpp -o benchDirect
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+#include "TempTable100kB3950x100.h"
+#include "TempTable100kB3950x128.h"
+#include "ThermistorTable.h"
+
+typedef std::chrono::steady_clock Clock;
+
+typedef DirectTempTable<100000, 3950, 100000, 10, false, 128> Direct;
+typedef TempTable<100000, 3950, 100000, 10, 5, false, 128> Interpolated;
+
+static const int REPS = 20000;
+
+//-----------------------------------------------
+static double reference(int c)
+{
+    double rth = 100000.0 * (1023.0 / c - 1);
+    return 1 / (1 / 298.15 + log(rth / 100000.0) / 3950) - 273.15;
+}
+//-----------------------------------------------
+template<typename L>
+static void run(const char* name, const L& l, size_t bytes)
+{
+    long sum = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (uint16_t c = 0; c < 1024; ++c)
+            sum += l.raw(c);
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (1024.0 * REPS) * 1e9;
+
+    // error over the usable range (first/last buckets are clamp values)
+    double maxErr = 0, sumErr = 0;
+    int n = 0;
+    for (int c = 32; c < 992; ++c, ++n)
+    {
+        double e = fabs(l.raw(c) / 128.0 - reference(c));
+        sumErr += e;
+        if (e > maxErr)
+            maxErr = e;
+    }
+    printf("%-13s %6u B  %5.2f ns/op  max %.4fC  mean %.4fC  (checksum %ld)\n",
+        name, unsigned(bytes), ns, maxErr, sumErr / n, sum);
+}
+//-----------------------------------------------
+/** Counts where the compile-time table differs from the generated one. */
+template<typename C, typename G>
+static int mismatches(const char* name, const C& compiled, const G& generated)
+{
+    int n = 0;
+    for (uint16_t c = 0; c < 1024; ++c)
+        if (compiled.raw(c) != generated.raw(c))
+        {
+            if (!n)
+                printf("%s: count %u gives %d, generated %d\n",
+                    name, unsigned(c), compiled.raw(c), generated.raw(c));
+            ++n;
+        }
+    printf("%-13s %d of 1024 counts differ from the generated table\n", name, n);
+    return n;
+}
+//-----------------------------------------------
+int main()
+{
+    run("direct", Direct::_instance, Direct::tableBytes());
+    run("interpolated", Interpolated::_instance, sizeof(Interpolated::Gen::Table));
+
+    int bad = mismatches("x128", Interpolated::_instance, TempTable100kB3950x128::_instance);
+    bad += mismatches("x100", TempTable<100000, 3950, 100000, 10, 5, false, 100>::_instance,
+        TempTable100kB3950x100::_instance);
+
+    printf("budget 256 B -> %s, 4096 B -> %s\n",
+        TempTableFor<100000, 3950, 100000, 10, 5, false, 128, 256>::direct ? "direct" : "interpolated",
+        TempTableFor<100000, 3950, 100000, 10, 5, false, 128, 4096>::direct ? "direct" : "interpolated");
+    return bad ? 1 : 0;
+}
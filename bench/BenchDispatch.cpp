@@ -0,0 +1,93 @@
+/** @file
+    Host benchmark: virtual (ILookup), static (LookupBase / CRTP) and
+    type-erased (LookupHandle) dispatch over a sweep of all 1024 ADC codes.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchDispatch.cpp src/TempTable100kB3950x128.cpp src/TempTable100kB3950x100.cpp -o benchDispatch
+ */
+#include <chrono>
+#include <stdio.h>
+
+#include "TempTable100kB3950x128.h"
+#include "TempTable100kB3950x100.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int REPS = 20000;
+
+/// Same table as TempTable100kB3950x128, no vptr
+typedef InterpolatedLookup1DBits<int16_t, float, 10, 5, InterpolatedLookup1DStatic> StaticTable;
+
+//-----------------------------------------------
+static double seconds(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+//-----------------------------------------------
+static long sweepVirtual(const ILookup& l)
+{
+    long sum = 0;
+    for (int r = 0; r < REPS; ++r)
+        for (int c = 0; c < 1024; ++c)
+            sum += l.lookupRaw(c);
+    return sum;
+}
+//-----------------------------------------------
+template<typename D>
+static long sweepStatic(const LookupBase<D>& l)
+{
+    long sum = 0;
+    for (int r = 0; r < REPS; ++r)
+        for (int c = 0; c < 1024; ++c)
+            sum += l.lookupRaw(c);
+    return sum;
+}
+//-----------------------------------------------
+static long sweepHandle(const LookupHandle& l)
+{
+    long sum = 0;
+    for (int r = 0; r < REPS; ++r)
+        for (int c = 0; c < 1024; ++c)
+            sum += l.lookupRaw(c);
+    return sum;
+}
+//-----------------------------------------------
+int main()
+{
+    // pick at run time so the compiler can't devirtualise
+    const ILookup* tables[] = { &TempTable100kB3950x128::_instance, &TempTable100kB3950x100::_instance };
+    volatile int which = 0;
+    const ILookup& virt = *tables[which];
+
+    const StaticTable stat(TempTable100kB3950x128::_instance.table(), 128);
+
+    const LookupHandle handles[] = { TempTable100kB3950x128::_instance, TempTable100kB3950x100::_instance };
+    const LookupHandle& handle = handles[which];
+
+    double ops = 1024.0 * REPS;
+
+    auto t0 = Clock::now();
+    long sv = sweepVirtual(virt);
+    double tv = seconds(t0);
+
+    t0 = Clock::now();
+    long ss = sweepStatic(stat);
+    double ts = seconds(t0);
+
+    t0 = Clock::now();
+    long sh = sweepHandle(handle);
+    double th = seconds(t0);
+
+    printf("sizeof: virtual %u, static %u, handle %u bytes\n",
+        (unsigned)sizeof(TempTable100kB3950x128), (unsigned)sizeof(StaticTable), (unsigned)sizeof(LookupHandle));
+    printf("virtual (ILookup)    %6.2f ns/op\n", tv / ops * 1e9);
+    printf("static (LookupBase)  %6.2f ns/op\n", ts / ops * 1e9);
+    printf("type-erased handle   %6.2f ns/op\n", th / ops * 1e9);
+
+    if (sv != ss || sv != sh)
+    {
+        printf("MISMATCH %ld %ld %ld\n", sv, ss, sh);
+        return 1;
+    }
+    return 0;
+}
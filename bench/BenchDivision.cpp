@@ -0,0 +1,118 @@
+/** @file
+    Host check and benchmark for the divide-free partition/interpolation.
+
+    Proves (exhaustively) that the multiply/shift replacements match
+    division for the lookup shapes in the library, lists how each
+    divider forms its product (the AVR cost, see ConstDivider.h), then
+    times a sweep. The host times only show nothing regressed: GCC
+    already turns the plain division into a multiply on x86.
+    Build twice to compare against plain division:
+        g++ -O2 -Isrc bench/BenchDivision.cpp src/TempTable100kB3950x128.cpp -o benchDivision
+        g++ -O2 -DCONST_DIVIDER_DIVIDE=1 -Isrc bench/BenchDivision.cpp src/TempTable100kB3950x128.cpp -o benchDivide
+ */
+#include <chrono>
+#include <type_traits>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "TempTable100kB3950x128.h"
+#include "hs1101Table.h"
+
+typedef std::chrono::steady_clock Clock;
+
+typedef InterpolatedLookup1DScaledOffset<int16_t, float, 20, 256, 162> HumidShape;
+typedef InterpolatedLookup1DScaled<int16_t, float, 24, 100> StepShape;
+
+//-----------------------------------------------
+static double seconds(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+//-----------------------------------------------
+template<typename L>
+static bool check(const char* name)
+{
+    bool ok = L::verifyDivisionFree();
+    printf("%-28s %s\n", name, ok ? "exact" : "MISMATCH");
+    return ok;
+}
+//-----------------------------------------------
+template<typename C>
+static void path(const char* name, uint32_t d, uint32_t maxn)
+{
+    printf("  %-34s /%-4u n <= %-8u %s", name, unsigned(d), unsigned(maxn),
+        C::isPow2() ? "shift" : C::isNarrow() ? "narrow: 32 bit product"
+        : C::isSplit() ? "split: 4 x 16x16->32"
+        : C::isLong() ? "long: 4 x 16x16->32, carries kept" : "wide: 64 bit product");
+    if (!C::isPow2())
+        printf(", m=%llu >> %u", (unsigned long long)C::multiplier(), C::shift());
+    printf("\n");
+}
+//-----------------------------------------------
+int main()
+{
+    bool ok = check<TempTable100kB3950x128>("TempTable100kB3950x128")
+        && check<HumidShape>("ScaledOffset<20,256,162>")
+        && check<StepShape>("Scaled<24,100>");
+
+    printf("products\n");
+    typedef TempTable100kB3950x128::residue_divider_t TempDiv;
+    typedef HumidShape::residue_divider_t HumidDiv;
+    typedef StepShape::residue_divider_t StepDiv;
+    typedef HumidShape::partitioner_t::divider_t HumidPart;
+    typedef StepShape::partitioner_t::divider_t StepPart;
+    path<TempDiv>("TempTable interpolation", 31, 31 * 65535 + 15);
+    path<HumidDiv>("ScaledOffset<20,256,162> interp.", 255, 255 * 65535 + 127);
+    path<HumidPart>("ScaledOffset<20,256,162> partition", 256, 19 * 256);
+    path<StepDiv>("Scaled<24,100> interpolation", 99, 99 * 65535 + 49);
+    path<StepPart>("Scaled<24,100> partition", 100, 65535);
+
+    // a signed index is bounded by its largest positive value, not ~0
+    typedef ScaledPartitioner<int16_t, 13, 1270> SignedPart;
+    static_assert(std::is_same<SignedPart::divider_t, ConstDivider<1270, 32767> >::value, "signed Scaled partition");
+    path<SignedPart::divider_t>("Scaled<int16_t,13,1270> partition", 1270, 32767);
+    ok = SignedPart::verify() && ok;
+
+    // HS1101Lookup's x127 10C rows: residues up to the whole step, int16 differences
+    typedef ConstDivider<1270, 1270 * 65535> RowBlend;
+    static_assert(RowBlend::isLong(), "row blend off the 64 bit path");
+    path<RowBlend>("ND /1270 row blend", 1270, 1270 * 65535);
+    bool rowOk = RowBlend::verify();
+    printf("  ND /1270 row blend verify %s\n", rowOk ? "exact" : "MISMATCH");
+    ok = rowOk && ok;
+
+    // the real table wouldn't make /31 narrow either
+    static_assert(ConstDivider<31, 63487>::isNarrow() && !ConstDivider<31, 63488>::isNarrow(), "narrow /31 limit");
+    int maxDiff = 0;
+    const int16_t* t = TempTable100kB3950x128::_instance.table();
+    for (int i = 0; i + 1 < TempTable100kB3950x128::partitioner_t::tableSize(); ++i)
+        maxDiff = abs(t[i + 1] - t[i]) > maxDiff ? abs(t[i + 1] - t[i]) : maxDiff;
+    printf("  TempTable100kB3950x128 max |diff| %d, so 31*diff up to %d; narrow /31 needs under %u\n",
+        maxDiff, 31 * maxDiff, unsigned(63488));
+
+    const int REPS = 20000;
+    const auto& tab = TempTable100kB3950x128::_instance;
+    static int16_t steps[25];
+    for (int i = 0; i < 25; ++i)
+        steps[i] = int16_t(i * 1000 - (i * i) * 20);
+    const StepShape step(steps, 1);
+
+    long sum = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (uint16_t c = 0; c < 1024; ++c)
+            sum += tab.raw(c);
+    double tt = seconds(t0);
+
+    t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (uint16_t c = 0; c < 2400; c += 3)
+            sum += step.raw(c);
+    double ts = seconds(t0);
+
+    printf("%s\n", CONST_DIVIDER_DIVIDE ? "division" : "multiply/shift");
+    printf("TempTable100kB3950x128 raw()  %6.2f ns/op\n", tt / (1024.0 * REPS) * 1e9);
+    printf("Scaled<24,100> raw()          %6.2f ns/op\n", ts / (800.0 * REPS) * 1e9);
+    printf("(checksum %ld)\n", sum);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+/** @file
+    Host benchmark: fixed point (ThermistorFixed) against float
+    (Thermistor) Beta equation for 100k/3950 with a 100k load on a 10 bit
+    ADC; time per conversion and error against the double equation, over
+    the counts for -40C..150C and over every count.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchFixed.cpp src/Thermistor.cpp src/ThermistorFixed.cpp -o benchFixed
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+#include "Thermistor.h"
+#include "ThermistorFixed.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int REPS = 20000;
+
+//-----------------------------------------------
+static double reference(int c)
+{
+    double rth = 100000.0 * (1023.0 / c - 1);
+    return 1 / (1 / 298.15 + log(rth / 100000.0) / 3950) - 273.15;
+}
+//-----------------------------------------------
+template<typename F>
+static void run(const char* name, F f)
+{
+    double sum = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (uint16_t c = 0; c < 1024; ++c)
+            sum += f(c);
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (1024.0 * REPS) * 1e9;
+
+    // -40C..150C is counts 25..1005
+    double maxIn = 0, maxAll = 0;
+    for (int c = 1; c < 1023; ++c)
+    {
+        if (reference(c) > 150)
+            continue;
+        double e = fabs(f(c) - reference(c));
+        if (c >= 25 && e > maxIn)
+            maxIn = e;
+        if (e > maxAll)
+            maxAll = e;
+    }
+    printf("%-8s %6.2f ns/op  max %.4fC (-40C..150C)  max %.4fC (count 1..150C)  (checksum %.0f)\n",
+        name, ns, maxIn, maxAll, sum);
+}
+//-----------------------------------------------
+int main()
+{
+    Thermistor th;
+    th._rl = 100000;
+    th._vAdcMax = 3.3;
+    th._vDrive = 3.3;
+    ThermistorFixed fx(th, 128);
+
+    run("float", [&](uint16_t c) { return double(th.tempFromCounts(c)); });
+    run("fixed", [&](uint16_t c) { return fx.raw(c) / 128.0; });
+    return 0;
+}
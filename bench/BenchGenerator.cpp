@@ -0,0 +1,122 @@
+/** @file
+    Host benchmark: HS1101Generator. Newton inversion against the 54 step
+    bisection hs1101.py uses (time per cell, and whether any table entry
+    differs), a whole table serially and with a thread per core, and an
+    in-memory table run through HS1101Mapped via a calibration image.
+
+    Build (from the repo root):
+        g++ -O2 -pthread -Isrc bench/BenchGenerator.cpp src/HS1101Generator.cpp src/CalImage.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp -o benchGenerator
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "CalImage.h"
+#include "HS1101Generator.h"
+#include "HS1101Mapped.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile double sink;
+
+//-----------------------------------------------
+static double us(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count() * 1e6;
+}
+//-----------------------------------------------
+/// hs1101.py's bisect() on Sensor, for comparison
+static double bisectRH(double cap, double temp)
+{
+    double c = 180 + temp * 0.04;
+    auto f = [&](double rh) { return c * (1.25e-7 * rh * rh * rh - 1.36e-5 * rh * rh + 2.19e-3 * rh + 9.0e-1) - cap; };
+    double lo = -200, hi = 200, mid = 0;
+    for (int i = 0; i < 54; ++i)
+    {
+        mid = (lo + hi) / 2;
+        if (f(lo) * f(mid) > 0)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return mid;
+}
+//-----------------------------------------------
+int main()
+{
+    HS1101GenParams p;
+    HS1101Generator g(p);
+
+    // every cell of the table, both ways
+    const int reps = 200;
+    int differ = 0;
+    double maxDiff = 0;
+    double newton = 0, bisect = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        auto t0 = Clock::now();
+        double s = 0;
+        for (int r = 0; r < reps; ++r)
+            for (int t = p.tmin; t <= p.tmax; t += p.tstep)
+                for (int c = p.fcmin; c <= p.fcmax; c += p.fcstep)
+                {
+                    double cap = g.capFromCounts(c);
+                    s += pass ? bisectRH(cap, t) : HS1101Generator::rhFromCapTemp(cap, t);
+                }
+        (pass ? bisect : newton) = us(t0);
+        sink = s;
+    }
+    for (int t = p.tmin; t <= p.tmax; t += p.tstep)
+        for (int c = p.fcmin; c <= p.fcmax; c += p.fcstep)
+        {
+            double a = HS1101Generator::rhFromCapTemp(g.capFromCounts(c), t);
+            double b = bisectRH(g.capFromCounts(c), t);
+            differ += int(a * p.hscale + 0.5) != int(b * p.hscale + 0.5);
+            maxDiff = fabs(a - b) > maxDiff ? fabs(a - b) : maxDiff;
+        }
+    double cells = double(reps) * 13 * 24;
+    printf("per cell: newton %.1f ns, bisection %.1f ns; max |diff| %.2g RH%%, %d entries differ\n",
+        newton / cells * 1e3, bisect / cells * 1e3, maxDiff, differ);
+
+    // whole tables, a variant per sensor
+    const unsigned threads[] = { 1, 0 };
+    for (unsigned th : threads)
+    {
+        auto t0 = Clock::now();
+        const int tables = 1000;
+        for (int i = 0; i < tables; ++i)
+        {
+            HS1101GenParams v;
+            v.cStrayPf = i * 0.01;
+            HS1101Generator gv(v);
+            gv.generate(th);
+        }
+        printf("%d tables, %s: %.1f us/table\n", tables, th == 1 ? "1 thread " : "per core", us(t0) / tables);
+    }
+
+    // in memory, straight into HS1101 through a calibration image
+    g.generate();
+    CalImageWriter w;
+    g.write(w, 1);
+    std::vector<uint8_t> image = w.build();
+    CalImage img;
+    HS1101Mapped<HS1101Rt100k0Rs100k0Tl_10Th110Data> mapped;
+    HS1101Rt100k0Rs100k0Tl_10Th110 compiled;
+    bool ok = img.open(image.data(), image.size()) == CalImage::Status::Ok && mapped.attach(*img.find(1));
+
+    int mismatches = 0;
+    for (uint16_t c = 8400; c < 10900; c += 7)
+        for (int16_t t = -1400; t < 14100; t += 101)
+        {
+            int16_t a, b;
+            compiled.computeRH(c, t, a);
+            mapped.computeRH(c, t, b);
+            mismatches += a != b;
+        }
+    for (uint16_t adc = 0; adc < 1024; ++adc)
+        mismatches += mapped.rawTemp(adc) != compiled.rawTemp(adc);
+    printf("in memory table attached %s, %d mismatches against the generated source\n", ok ? "ok" : "FAILED", mismatches);
+    return !ok || mismatches;
+}
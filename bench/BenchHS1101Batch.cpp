@@ -0,0 +1,73 @@
+/** @file
+    Host benchmark: HS1101::computeRHBatch() (structure of arrays) against
+    a per-call computeRH() loop for HS1101Rt100k0Rs150k0Tl_10Th50, over
+    a mix of readings from many nodes with some out of range in both
+    counts and temperature. Checks the results and status are identical.
+
+    Build (from the repo root), the SSE2 kernel and the AVX2 one:
+        g++ -O2 -Isrc bench/BenchHS1101Batch.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50.cpp -o benchHS1101Batch
+        g++ -O2 -mavx2 -Isrc bench/BenchHS1101Batch.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50.cpp -o benchHS1101BatchAvx2
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HS1101Rt100k0Rs150k0Tl_10Th50.h"
+
+typedef std::chrono::steady_clock Clock;
+typedef HS1101Rt100k0Rs150k0Tl_10Th50 Sensor;
+
+static const int N = 4096;
+static const int REPS = 5000;
+
+static uint16_t counts[N];
+static int16_t temps[N];
+static int16_t humid[2][N];
+static Sensor::Status status[2][N];
+
+//-----------------------------------------------
+int main()
+{
+    Sensor s;
+
+    srand(1);
+    for (int i = 0; i < N; ++i)
+    {
+        counts[i] = 8400 + rand() % 2500;           // a little past both ends
+        temps[i] = -1400 + rand() % (6500 + 1400);   // -11C..51C, x127
+    }
+
+    long sum = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+    {
+        for (int i = 0; i < N; ++i)
+            status[0][i] = s.computeRH(counts[i], temps[i], humid[0][i]);
+        sum += humid[0][r % N];
+    }
+    double perCall = std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+
+    t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+    {
+        s.computeRHBatch(counts, temps, humid[1], status[1], N);
+        sum += humid[1][r % N];
+    }
+    double batch = std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+
+    int mismatches = 0;
+    for (int i = 0; i < N; ++i)
+        mismatches += humid[0][i] != humid[1][i] || status[0][i] != status[1][i];
+
+#if defined(__AVX2__)
+    const char* kernel = "avx2";
+#elif defined(__SSE2__)
+    const char* kernel = "sse2";
+#else
+    const char* kernel = "scalar";
+#endif
+    printf("per call  %5.2f ns/sample\n", perCall);
+    printf("batch     %5.2f ns/sample (%s), %.1fx\n", batch, kernel, perCall / batch);
+    printf("mismatches %d of %d  (checksum %ld)\n", mismatches, N, sum);
+    return mismatches != 0;
+}
@@ -0,0 +1,120 @@
+/** @file
+    Host benchmark: HS1101Cached (temperature row cache) against
+    computeRH() for HS1101Rt100k0Rs150k0Tl_10Th50, with temperature
+    drifting at several rates while humidity counts move every sample;
+    plus bursts at one temperature. Reports the speedup, how often the
+    row was rebuilt, and the largest difference from computeRH().
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchHS1101Cache.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50.cpp -o benchHS1101Cache
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HS1101Rt100k0Rs150k0Tl_10Th50.h"
+
+typedef std::chrono::steady_clock Clock;
+typedef HS1101Rt100k0Rs150k0Tl_10Th50 Sensor;
+typedef HS1101Cached<HS1101Rt100k0Rs150k0Tl_10Th50Data> Cached;
+
+static const int N = 1 << 16;
+static const int REPS = 100;
+
+static uint16_t counts[N];
+static int16_t temps[N];
+static int16_t humid[2][N];
+static Sensor::Status status[2][N];
+
+//-----------------------------------------------
+static double seconds(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+//-----------------------------------------------
+/// Temperature sweeping 10C..40C and back at rate C/sample
+static void drift(double rate)
+{
+    double t = 10, dt = rate;
+    for (int i = 0; i < N; ++i)
+    {
+        t += dt;
+        if (t > 40 || t < 10)
+            dt = -dt;
+        temps[i] = int16_t(t * 127);
+        counts[i] = 8550 + rand() % 2200;
+    }
+}
+//-----------------------------------------------
+static void compare(const char* name, double perCall, double cached, uint32_t rebuilds)
+{
+    int maxDiff = 0;
+    int statusDiff = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        int d = abs(humid[0][i] - humid[1][i]);
+        if (d > maxDiff)
+            maxDiff = d;
+        statusDiff += status[0][i] != status[1][i];
+    }
+    printf("%-34s %6.2f %6.2f  %4.1fx  rebuilds %6.3f%%  max diff %.3fRH%%  status diffs %d\n",
+        name, perCall, cached, perCall / cached, 100.0 * rebuilds / (double(N) * REPS),
+        maxDiff / 256.0, statusDiff);
+}
+//-----------------------------------------------
+int main()
+{
+    Sensor s;
+    srand(1);
+    printf("%-34s %6s %6s  speedup\n", "", "ns/op", "cached");
+
+    // a sample a second at 1C/min is ~0.017C/sample
+    const double rates[] = { 0.0001, 0.001, 0.017, 0.1 };
+    for (double rate : rates)
+    {
+        drift(rate);
+
+        auto t0 = Clock::now();
+        for (int r = 0; r < REPS; ++r)
+            for (int i = 0; i < N; ++i)
+                status[0][i] = s.computeRH(counts[i], temps[i], humid[0][i]);
+        double perCall = seconds(t0) / (double(N) * REPS) * 1e9;
+
+        // tolerance 0.1C and 1C
+        const int16_t tols[] = { 13, 127 };
+        for (int16_t tol : tols)
+        {
+            Cached c(tol);
+            t0 = Clock::now();
+            for (int r = 0; r < REPS; ++r)
+                for (int i = 0; i < N; ++i)
+                    status[1][i] = c.computeRHCached(counts[i], temps[i], humid[1][i]);
+            double cached = seconds(t0) / (double(N) * REPS) * 1e9;
+
+            char name[48];
+            snprintf(name, sizeof(name), "drift %gC/sample, tol %.1fC", rate, tol / 127.0);
+            compare(name, perCall, cached, c.rebuilds());
+        }
+    }
+
+    // bursts of 64 at one temperature
+    drift(0.017);
+    for (int i = 0; i < N; ++i)
+        temps[i] = temps[i & ~63];
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; ++i)
+            status[0][i] = s.computeRH(counts[i], temps[i], humid[0][i]);
+    double perCall = seconds(t0) / (double(N) * REPS) * 1e9;
+
+    Cached c(0);
+    t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; i += 64)
+            c.computeRHBurst(counts + i, temps[i], humid[1] + i, status[1] + i, 64);
+    double cached = seconds(t0) / (double(N) * REPS) * 1e9;
+    compare("burst 64, exact temp", perCall, cached, c.rebuilds());
+    return 0;
+}
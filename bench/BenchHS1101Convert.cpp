@@ -0,0 +1,136 @@
+/** @file
+    Host benchmark: rawTemp() then computeRH() against the fused
+    HS1101::convert() and HS1101RowMap::convert(), on random thermistor
+    ADC counts (all 1024, so both clamps get exercised) and oscillator
+    counts. Reports ns and TSC ticks per sample and checks every path
+    against the two calls over every ADC count and a sweep of oscillator
+    counts; also with the thermistor table reversed, i.e. falling with
+    ADC count as an NTC on the low side of the divider gives.
+
+    The host divides by a constant with a multiply, so the row map is no
+    faster here; it only stands to gain where the row selection's divide
+    is a library call (__divmodhi4 on the AVR, generic grids).
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchHS1101Convert.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.cpp -o benchHS1101Convert
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int N = 1 << 16;
+static const int REPS = 200;
+
+static uint16_t adcs[N];
+static uint16_t counts[N];
+
+//-----------------------------------------------
+/// ns and ticks per sample of f over the inputs
+template<typename F>
+static void time(F f, double& ns, double& ticks, long& sum)
+{
+    auto t0 = Clock::now();
+#if HAVE_TSC
+    auto c0 = __rdtsc();
+#endif
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; ++i)
+            sum += f(adcs[i], counts[i]);
+    ticks = 0;
+#if HAVE_TSC
+    ticks = double(__rdtsc() - c0) / (double(N) * REPS);
+#endif
+    ns = std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+}
+//-----------------------------------------------
+/// D with its thermistor table reversed, so temperature falls with ADC count
+template<typename D>
+struct Falling : D
+{
+    static int16_t _therm_table[D::_therm_table_size];
+
+    static void build()
+    {
+        for (unsigned i = 0; i < D::_therm_table_size; ++i)
+            _therm_table[i] = D::_therm_table[D::_therm_table_size - 1 - i];
+    }
+};
+template<typename D>
+int16_t Falling<D>::_therm_table[D::_therm_table_size];
+//-----------------------------------------------
+template<typename D>
+static int run(const char* name)
+{
+    typedef HS1101<D> H;
+    typedef typename H::Reading Reading;
+
+    H h;
+    HS1101RowMap<D> m;
+
+    double ns[3], ticks[3];
+    long sum[3] = { 0, 0, 0 };
+    time([&](uint16_t adc, uint16_t c)
+    {
+        int16_t t = h.rawTemp(adc), rh;
+        int s = int(h.computeRH(c, t, rh));
+        return t + rh + s;
+    }, ns[0], ticks[0], sum[0]);
+    time([&](uint16_t adc, uint16_t c)
+    {
+        Reading r = h.convert(adc, c);
+        return r.tempRaw + r.humidRaw + int(r.status);
+    }, ns[1], ticks[1], sum[1]);
+    time([&](uint16_t adc, uint16_t c)
+    {
+        Reading r = m.convert(adc, c);
+        return r.tempRaw + r.humidRaw + int(r.status);
+    }, ns[2], ticks[2], sum[2]);
+
+    int diff = 0;
+    for (uint16_t adc = 0; adc < 1024; ++adc)
+        for (uint16_t c = 8400; c < 11300; c += 3)
+        {
+            int16_t t = h.rawTemp(adc), rh;
+            auto s = h.computeRH(c, t, rh);
+            Reading a = h.convert(adc, c), b = m.convert(adc, c);
+            diff += a.tempRaw != t || a.humidRaw != rh || a.status != s;
+            diff += b.tempRaw != t || b.humidRaw != rh || b.status != s;
+        }
+
+    printf("%-40s %6.2f %6.1f  %6.2f %6.1f  %6.2f %6.1f  %5d  %s\n", name,
+        ns[0], ticks[0], ns[1], ticks[1], ns[2], ticks[2], diff,
+        sum[0] == sum[1] && sum[1] == sum[2] ? "" : "checksums differ");
+    return diff;
+}
+//-----------------------------------------------
+int main()
+{
+    srand(1);
+    for (int i = 0; i < N; ++i)
+    {
+        adcs[i] = rand() % 1024;
+        counts[i] = 8400 + rand() % 2900;
+    }
+
+    printf("%-40s %13s  %13s  %13s  %5s\n", "", "two calls", "convert", "row map", "");
+    printf("%-40s %6s %6s  %6s %6s  %6s %6s  %5s\n", "", "ns", "ticks", "ns", "ticks", "ns", "ticks", "diff");
+    int bad = 0;
+    bad += run<HS1101Rt100k0Rs100k0Tl_10Th110Data>("HS1101Rt100k0Rs100k0Tl_10Th110");
+    bad += run<HS1101Rt100k0Rs150k0Tl_10Th50Data>("HS1101Rt100k0Rs150k0Tl_10Th50");
+    bad += run<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data>("HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2");
+    Falling<HS1101Rt100k0Rs100k0Tl_10Th110Data>::build();
+    Falling<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data>::build();
+    bad += run<Falling<HS1101Rt100k0Rs100k0Tl_10Th110Data>>("... 10Th110, falling thermistor table");
+    bad += run<Falling<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data>>("... Cstray8P2, falling thermistor table");
+    return bad;
+}
@@ -0,0 +1,85 @@
+/** @file
+    Host benchmark: computeRH() on the plain int16_t humidity table
+    against the packed one (per column {base, slope} lines plus int8
+    residues) for HS1101Rt100k0Rs100k0Tl_10Th110. Reports the bytes each
+    table takes, ns and TSC ticks per sample, and checks that the packed
+    table gives the same result for every sample.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchHS1101Packed.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110Packed.cpp -o benchHS1101Packed
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110Packed.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int N = 1 << 16;
+static const int REPS = 200;
+
+static uint16_t counts[N];
+static int16_t temps[N];
+
+/// The tables are protected; a derived class can take their size
+struct PlainBytes : HS1101Rt100k0Rs100k0Tl_10Th110Data
+{
+    static const size_t value = sizeof(_hs1101_table);
+};
+struct PackedBytes : HS1101Rt100k0Rs100k0Tl_10Th110PackedData
+{
+    static const size_t value = sizeof(_hs1101_lines) + sizeof(_hs1101_resid);
+};
+
+//-----------------------------------------------
+template<typename H>
+static void run(const char* name, size_t bytes, int16_t* humid)
+{
+    H h;
+    long sum = 0;
+    auto t0 = Clock::now();
+#if HAVE_TSC
+    auto c0 = __rdtsc();
+#endif
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; ++i)
+        {
+            h.computeRH(counts[i], temps[i], humid[i]);
+            sum += humid[i];
+        }
+    double ticks = 0;
+#if HAVE_TSC
+    ticks = double(__rdtsc() - c0) / (double(N) * REPS);
+#endif
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+
+    printf("%-40s %5zu B  %6.2f ns  %6.1f ticks  (%ld)\n", name, bytes, ns, ticks, sum);
+}
+//-----------------------------------------------
+int main()
+{
+    static int16_t humid[2][N];
+
+    srand(1);
+    for (int i = 0; i < N; ++i)
+    {
+        counts[i] = 8400 + rand() % 2500;
+        temps[i] = int16_t(-1400 + rand() % 15500);
+    }
+
+    run<HS1101Rt100k0Rs100k0Tl_10Th110>("HS1101Rt100k0Rs100k0Tl_10Th110", PlainBytes::value, humid[0]);
+    run<HS1101Rt100k0Rs100k0Tl_10Th110Packed>("HS1101Rt100k0Rs100k0Tl_10Th110Packed", PackedBytes::value, humid[1]);
+
+    int mismatches = 0;
+    for (int i = 0; i < N; ++i)
+        mismatches += humid[0][i] != humid[1][i];
+    printf("saved %d B, mismatches %d of %d\n",
+        int(PlainBytes::value) - int(PackedBytes::value), mismatches, N);
+    return 0;
+}
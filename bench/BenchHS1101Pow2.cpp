@@ -0,0 +1,133 @@
+/** @file
+    Host benchmark: computeRH() on the generic grid (100 count columns,
+    10C rows at x127) against the power of two grid (128 count columns,
+    8C rows at x128) for the same 150k / 8pF sensor. Reports ns and TSC
+    ticks per sample, the error of each against the double model, and
+    checks computeRHBatch() and HS1101Cached on the power of two grid
+    against its computeRH().
+
+    The host divides in hardware, so this understates the gain on the
+    AVR, where each of the four divides in a generic computeRH() is a
+    __divmodhi4 / __divmodsi4 library call (roughly 200 and 600 cycles)
+    and the shifts are a few cycles each.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchHS1101Pow2.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.cpp -o benchHS1101Pow2
+    (add -mavx2 to check the vector kernel too)
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "HS1101Rt100k0Rs150k0Tl_10Th50.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int N = 1 << 16;
+static const int REPS = 200;
+
+static uint16_t counts[N];
+static double degrees[N];
+static double ref[N];
+
+//-----------------------------------------------
+/// RH% for oscillator counts at a temperature, as hs1101.py models it
+static double refRH(double counts, double temp, double cStrayPf = 8, double rOsc = 402700)
+{
+    double cap = 0.725 / (rOsc * counts) * 1e12 - cStrayPf;
+    double c = 180 + temp * 0.04;
+    double lo = -200, hi = 200;
+    for (int i = 0; i < 60; ++i)
+    {
+        double m = (lo + hi) / 2;
+        double f = c * (1.25e-7 * m * m * m - 1.36e-5 * m * m + 2.19e-3 * m + 0.9) - cap;
+        if (f < 0)
+            lo = m;
+        else
+            hi = m;
+    }
+    double r = (lo + hi) / 2;
+    return r < 0 ? 0 : r > 100 ? 100 : r;
+}
+//-----------------------------------------------
+template<typename D>
+static void run(const char* name)
+{
+    typedef HS1101<D> H;
+    typedef typename H::Status Status;
+    static int16_t temps[N];
+    static int16_t humid[3][N];
+    static Status status[3][N];
+
+    H h;
+    for (int i = 0; i < N; ++i)
+        temps[i] = int16_t(lround(degrees[i] * H::_therm_table_scale));
+
+    long sum = 0;
+    auto t0 = Clock::now();
+#if HAVE_TSC
+    auto c0 = __rdtsc();
+#endif
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; ++i)
+        {
+            h.computeRH(counts[i], temps[i], humid[0][i]);
+            sum += humid[0][i];
+        }
+    double ticks = 0;
+#if HAVE_TSC
+    ticks = double(__rdtsc() - c0) / (double(N) * REPS);
+#endif
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+
+    double maxErr = 0, sumErr = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        status[0][i] = h.computeRH(counts[i], temps[i], humid[0][i]);
+        double e = fabs(humid[0][i] / double(H::_humid_table_scale) - ref[i]);
+        sumErr += e;
+        if (e > maxErr)
+            maxErr = e;
+    }
+
+    // the other paths must agree with computeRH() on the same grid
+    h.computeRHBatch(counts, temps, humid[1], status[1], N);
+    HS1101Cached<D> cached(0);
+    for (int i = 0; i < N; ++i)
+        status[2][i] = cached.computeRHCached(counts[i], temps[i], humid[2][i]);
+
+    int batchDiff = 0, cachedDiff = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        batchDiff += humid[1][i] != humid[0][i] || status[1][i] != status[0][i];
+        int d = abs(humid[2][i] - humid[0][i]);
+        if (d > cachedDiff)
+            cachedDiff = d;
+    }
+
+    printf("%-40s %6.2f %7.1f  %7.4f %7.4f  %5d  %5d  (%ld)\n",
+        name, ns, ticks, maxErr, sumErr / N, batchDiff, cachedDiff, sum);
+}
+//-----------------------------------------------
+int main()
+{
+    srand(1);
+    for (int i = 0; i < N; ++i)
+    {
+        counts[i] = 8501 + rand() % 2299;
+        degrees[i] = -10 + (rand() % 6000) / 100.0;
+        ref[i] = refRH(counts[i], degrees[i]);
+    }
+
+    printf("%-40s %6s %7s  %7s %7s  %5s  %5s\n",
+        "computeRH", "ns/op", "ticks", "max RH%", "mean", "batch", "cache");
+    run<HS1101Rt100k0Rs150k0Tl_10Th50Data>("HS1101Rt100k0Rs150k0Tl_10Th50");
+    run<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data>("HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2");
+    return 0;
+}
@@ -0,0 +1,70 @@
+/** @file
+    Host benchmark: non-uniform knot table (KnotLookup1D) against uniform
+    interpolated tables of several sizes for the 100k/3950 x128
+    thermistor; table bytes, time per lookup, and error against the
+    double Beta equation over the knot table's -40C..125C range.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchKnot.cpp src/TempTable100kB3950x128Knots.cpp -o benchKnot
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+#include "ThermistorTable.h"
+#include "TempTable100kB3950x128Knots.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int REPS = 20000;
+
+//-----------------------------------------------
+static double reference(int c)
+{
+    double rth = 100000.0 * (1023.0 / c - 1);
+    return 1 / (1 / 298.15 + log(rth / 100000.0) / 3950) - 273.15;
+}
+//-----------------------------------------------
+template<typename L>
+static void run(const char* name, const L& l, size_t bytes, int c0, int c1)
+{
+    long sum = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (uint16_t c = 0; c < 1024; ++c)
+            sum += l.raw(c);
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (1024.0 * REPS) * 1e9;
+
+    double maxErr = 0, sumErr = 0;
+    for (int c = c0; c <= c1; ++c)
+    {
+        double e = fabs(l.raw(c) / 128.0 - reference(c));
+        sumErr += e;
+        if (e > maxErr)
+            maxErr = e;
+    }
+    printf("%-16s %5u B  %5.2f ns/op  max %.4fC  mean %.4fC  (checksum %ld)\n",
+        name, unsigned(bytes), ns, maxErr, sumErr / (c1 - c0 + 1), sum);
+}
+//-----------------------------------------------
+template<unsigned TABLEBITS>
+static void uniform(const char* name, int c0, int c1)
+{
+    typedef TempTable<100000, 3950, 100000, 10, TABLEBITS, false, 128> T;
+    run(name, T::_instance, sizeof(typename T::Gen::Table), c0, c1);
+}
+//-----------------------------------------------
+int main()
+{
+    const auto& knots = TempTable100kB3950x128Knots::_instance;
+    int c0 = knots.table()[0].count;
+    int c1 = knots.table()[knots.knots() - 1].count;
+
+    printf("counts %d..%d, %u knots\n", c0, c1, knots.knots());
+    run("knots", knots, knots.tableBytes(), c0, c1);
+    uniform<5>("uniform 32", c0, c1);
+    uniform<6>("uniform 64", c0, c1);
+    uniform<7>("uniform 128", c0, c1);
+    uniform<8>("uniform 256", c0, c1);
+    return 0;
+}
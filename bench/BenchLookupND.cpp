@@ -0,0 +1,221 @@
+/** @file
+    Host benchmark: InterpolatedLookupND.
+
+    - 2D: HS1101Lookup (the humidity table through the generic lookup)
+      against HS1101::computeRH() over a sweep of temperatures, both ends
+      clamped, and oscillator counts; values and status must match, pow2
+      grids (flooring axes) included. ns per conversion for both.
+    - 3D: a synthetic RH table with a supply voltage axis, against a
+      plain / and % trilinear reference in the same order (must match)
+      and a double one (rounding only).
+    - 1D: the 3D table's temperature axis on its own, through
+      InterpolatedLookup1DStatic, which doesn't clamp: inputs below the
+      negative offset and past the end give the end entries.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchLookupND.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.cpp -o benchLookupND
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HS1101Lookup.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int N = 1 << 16;
+static const int REPS = 200;
+
+static int16_t temps[N];
+static uint16_t counts[N];
+
+//-----------------------------------------------
+/// ns per conversion of f over the inputs
+template<typename F>
+static double time(F f, long& sum)
+{
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; ++i)
+            sum += f(temps[i], counts[i]);
+    return std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+}
+//-----------------------------------------------
+template<typename D>
+static int run2D(const char* name)
+{
+    HS1101<D> h;
+    HS1101Lookup<D> l;
+
+    const int tlo = D::_humid_table_tminsc - 2 * D::_humid_table_stepTsc;
+    const int thi = D::_humid_table_tmaxsc + 2 * D::_humid_table_stepTsc;
+    const int clo = D::_humid_table_locount - 200, chi = D::_humid_table_hicount + 200;
+    for (int i = 0; i < N; ++i)
+    {
+        temps[i] = int16_t(tlo + rand() % (thi - tlo));
+        counts[i] = uint16_t(clo + rand() % (chi - clo));
+    }
+
+    long sum[2] = { 0, 0 };
+    double ns0 = time([&](int16_t t, uint16_t c)
+    {
+        int16_t rh;
+        int s = int(h.computeRH(c, t, rh));
+        return rh + s;
+    }, sum[0]);
+    double ns1 = time([&](int16_t t, uint16_t c)
+    {
+        int16_t rh;
+        int s = int(l.computeRH(c, t, rh));
+        return rh + s;
+    }, sum[1]);
+
+    int diff = 0, worst = 0, status = 0;
+    for (int t = tlo; t <= thi; t += 7)
+        for (int c = clo; c <= chi; ++c)
+        {
+            int16_t a, b;
+            auto sa = h.computeRH(c, t, a);
+            auto sb = l.computeRH(c, t, b);
+            diff += a != b;
+            status += sa != sb;
+            worst = abs(a - b) > worst ? abs(a - b) : worst;
+        }
+
+    printf("%-40s %7.2f %7.2f  %6d %5d %6d  %s\n", name, ns0, ns1, diff, worst, status,
+        sum[0] == sum[1] ? "" : "checksums differ");
+    return status + diff;
+}
+//-----------------------------------------------
+// 3D: temperature x counts x supply millivolts
+typedef ScaledOffsetPartitioner<int16_t, 13, 1270, -1270> TempAxis;
+typedef ScaledOffsetPartitioner<uint16_t, 24, 100, 8500> CountsAxis;
+typedef ScaledOffsetPartitioner<uint16_t, 5, 250, 2700> SupplyAxis;
+typedef InterpolatedLookupND<int16_t, float, TempAxis, CountsAxis, SupplyAxis> Lookup3D;
+
+static int16_t table3[13 * 24 * 5];
+
+/// Same order as the lookup, plain / and %
+static int16_t naive3(int t, int c, int v)
+{
+    auto clamp = [](int x, int lo, int step, int n, int& b, int& r)
+    {
+        x -= lo;
+        if (x <= 0) x = 0;
+        if (x >= (n - 1) * step) x = (n - 1) * step;
+        b = x / step;
+        r = x % step;
+        if (b == n - 1) { b = n - 2; r = step; }
+    };
+    int bt, rt, bc, rc, bv, rv;
+    clamp(t, -1270, 1270, 13, bt, rt);
+    clamp(c, 8500, 100, 24, bc, rc);
+    clamp(v, 2700, 250, 5, bv, rv);
+
+    auto at = [&](int i, int j, int k) { return table3[((bt + i) * 24 + bc + j) * 5 + bv + k]; };
+    auto line = [&](int i, int j)
+    {
+        int v0 = at(i, j, 0);
+        return rv ? v0 + (at(i, j, 1) - v0) * rv / 250 : v0;
+    };
+    auto plane = [&](int i)
+    {
+        int v0 = line(i, 0);
+        return rc ? v0 + (line(i, 1) - v0) * rc / 100 : v0;
+    };
+    int v0 = plane(0);
+    return int16_t(rt ? v0 + (plane(1) - v0) * rt / 1270 : v0);
+}
+//-----------------------------------------------
+/// Exact trilinear in double
+static double exact3(int t, int c, int v)
+{
+    double ft = fmin(fmax((t + 1270) / 1270.0, 0), 12);
+    double fc = fmin(fmax((c - 8500) / 100.0, 0), 23);
+    double fv = fmin(fmax((v - 2700) / 250.0, 0), 4);
+    int it = ft >= 12 ? 11 : int(ft), ic = fc >= 23 ? 22 : int(fc), iv = fv >= 4 ? 3 : int(fv);
+    ft -= it; fc -= ic; fv -= iv;
+    double r = 0;
+    for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j)
+            for (int k = 0; k < 2; ++k)
+                r += table3[((it + i) * 24 + ic + j) * 5 + iv + k]
+                    * (i ? ft : 1 - ft) * (j ? fc : 1 - fc) * (k ? fv : 1 - fv);
+    return r;
+}
+//-----------------------------------------------
+static int run3D()
+{
+    // RH x256 rising with counts, falling with temperature, a few % per 250mV
+    for (int t = 0; t < 13; ++t)
+        for (int c = 0; c < 24; ++c)
+            for (int v = 0; v < 5; ++v)
+                table3[(t * 24 + c) * 5 + v] = int16_t(256 * (c * 4.3 - t * 0.9 + (v - 2) * 1.7 + 5 * sin(c * 0.4 + t)));
+
+    Lookup3D l(table3, 256);
+    int diff = 0;
+    double worst = 0;
+    for (int t = -3000; t <= 17000; t += 37)
+        for (int c = 8300; c <= 11000; c += 7)
+            for (int v = 2500; v <= 3900; v += 13)
+            {
+                LookupStatus s;
+                int16_t r = l.rawAt(s, t, c, v);
+                diff += r != naive3(t, c, v);
+                worst = fmax(worst, fabs(r - exact3(t, c, v)));
+            }
+
+    long sum = 0;
+    uint16_t mv[N];
+    for (int i = 0; i < N; ++i)
+        mv[i] = uint16_t(2600 + rand() % 1200);
+    auto t0 = Clock::now();
+    for (int r = 0; r < REPS; ++r)
+        for (int i = 0; i < N; ++i)
+        {
+            LookupStatus s;
+            sum += l.rawAt(s, temps[i], counts[i], mv[i]);
+        }
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (double(N) * REPS) * 1e9;
+
+    printf("\n3D temp x counts x supply (%u entries): %.2f ns, %d differ from / and %%, worst %.2f units from exact (checksum %ld)\n",
+        unsigned(Lookup3D::tableSize()), ns, diff, worst, sum);
+    return diff;
+}
+//-----------------------------------------------
+static int run1D()
+{
+    static int16_t column[13];
+    for (int t = 0; t < 13; ++t)
+        column[t] = table3[t * 24 * 5];
+    typedef InterpolatedLookup1DStatic<int16_t, float, TempAxis> Lookup1D;
+
+    int wrong = 0;
+    for (int t = -32768; t <= 32767; t += 11)
+    {
+        int16_t r = Lookup1D::rawFrom(column, int16_t(t));
+        if (t <= -1270 + 1270)
+            wrong += r != column[0];
+        else if (t >= -1270 + 12 * 1270)
+            wrong += r != column[12];
+    }
+    printf("1D signed axis, -1270 offset: %d outside the table not its end entries\n", wrong);
+    return wrong;
+}
+//-----------------------------------------------
+int main()
+{
+    srand(1);
+    printf("%-40s %15s  %6s %5s %6s\n", "", "ns computeRH/ND", "diff", "worst", "status");
+    int bad = 0;
+    bad += run2D<HS1101Rt100k0Rs100k0Tl_10Th110Data>("HS1101Rt100k0Rs100k0Tl_10Th110");
+    bad += run2D<HS1101Rt100k0Rs150k0Tl_10Th50Data>("HS1101Rt100k0Rs150k0Tl_10Th50");
+    bad += run2D<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data>("HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2");
+    bad += run3D();
+    bad += run1D();
+    return bad;
+}
@@ -0,0 +1,105 @@
+/** @file
+    Host model: the 1s gated count against reciprocal counting of N
+    periods (HumidATtiny3216::setReciprocal()), for the humidity
+    oscillator range of HS1101Rt100k0Rs100k0Tl_10Th110.
+
+    Oscillator edges fall at a random phase; the gate counts the edges
+    in 1s, reciprocal mode takes the main clock tick of each edge as
+    TCB0's frequency measurement captures it, sums N periods and goes
+    through ReciprocalCount::counts() as the AVR does. Reported per N:
+
+    - latency: a partial period plus N whole ones;
+    - resolution: one clock tick in the N periods, as counts and RH%;
+    - worst error of the 1s equivalent counts over the samples, with
+      the clock exact and with it 1024Hz out (the resolution of
+      HumidATtiny3216::calibrateClock()), and that as RH% at 25C.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchReciprocal.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp -o benchReciprocal
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HS1101.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "Reciprocal.h"
+
+typedef HS1101Rt100k0Rs100k0Tl_10Th110Data D;
+
+static const uint32_t CLK = 20000000;
+static const int SAMPLES = 20000;
+
+//-----------------------------------------------
+static double frand()
+{
+    return rand() / (RAND_MAX + 1.0);
+}
+//-----------------------------------------------
+/// RH% per oscillator count at 25C, mid range
+static double rhPerCount()
+{
+    HS1101<D> h;
+    int16_t a, b;
+    const uint16_t c = (D::_humid_table_locount + D::_humid_table_hicount) / 2;
+    const int16_t t = int16_t(25 * D::_therm_table_scale);
+    h.computeRH(c, t, a);
+    h.computeRH(c + 100, t, b);
+    return fabs(D::scaleHumid(b - a)) / 100;
+}
+//-----------------------------------------------
+/// Edges in a 1s gate opening at a random phase
+static uint16_t gate(double f)
+{
+    double phase = frand() / f;
+    return uint16_t(floor((1 - phase) * f) + 1);
+}
+//-----------------------------------------------
+/// ReciprocalCount::counts() of n periods timed on a clock of clkHz, believed to be CLK
+static uint16_t reciprocal(double f, uint8_t n, double clkHz)
+{
+    // the capture before the first is the partial period thrown away
+    double t0 = frand() / f;
+    uint32_t c0 = uint32_t(floor(t0 * clkHz));
+    uint32_t c1 = uint32_t(floor((t0 + n / f) * clkHz));
+    return ReciprocalCount::counts(n, c1 - c0, CLK);
+}
+//-----------------------------------------------
+int main()
+{
+    srand(1);
+    const double rhpc = rhPerCount();
+    const double flo = D::_humid_table_locount, fhi = D::_humid_table_hicount;
+
+    printf("oscillator %.0f..%.0fHz, clock %uMHz, %.4f RH%% per count at 25C\n\n",
+        flo, fhi, unsigned(CLK / 1000000), rhpc);
+    printf("%5s  %11s  %16s  %27s  %s\n", "", "latency ms", "resolution", "worst error, counts", "worst RH%");
+    printf("%5s  %5s %5s  %7s %8s  %8s %18s  %s\n", "N", "best", "worst", "counts", "RH%",
+        "exact", "clock 1024Hz out", "(clock out)");
+
+    double worst = 0;
+    for (int i = 0; i < SAMPLES; ++i)
+    {
+        double f = flo + frand() * (fhi - flo);
+        worst = fmax(worst, fabs(gate(f) - f));
+    }
+    printf("%5s  %5.0f %5.0f  %7.4f %8.5f  %8.3f %18s  %.4f\n", "gate", 1000.0, 1000.0, 1.0, rhpc, worst, "-", worst * rhpc);
+
+    int bad = 0;
+    for (int n = 1; n <= ReciprocalCount::maxPeriods; n *= 2)
+    {
+        double exact = 0, off = 0;
+        for (int i = 0; i < SAMPLES; ++i)
+        {
+            double f = flo + frand() * (fhi - flo);
+            exact = fmax(exact, fabs(reciprocal(f, uint8_t(n), CLK) - f));
+            off = fmax(off, fabs(reciprocal(f, uint8_t(n), CLK + 1024.0) - f));
+        }
+        // one tick in n periods of the fastest oscillator
+        double res = fhi * fhi / (double(n) * CLK);
+        printf("%5d  %5.2f %5.2f  %7.4f %8.5f  %8.3f %18.3f  %.4f\n", n,
+            1e3 * n / fhi, 1e3 * (n + 1) / flo, res, res * rhpc, exact, off, off * rhpc);
+        bad += n >= 16 && exact > 1;
+    }
+    return bad;
+}
@@ -0,0 +1,73 @@
+/** @file
+    Host benchmark: plain table (InterpolatedLookup1D) against the
+    interleaved {base, slope} table (InterpolatedSlopeLookup1D) for the
+    100k/3950 x128 thermistor; time per lookup, table size and the
+    largest difference between the two.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchSlope.cpp src/TempTable100kB3950x128.cpp src/TempTable100kB3950x128Slope.cpp -o benchSlope
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "TempTable100kB3950x128.h"
+#include "TempTable100kB3950x128Slope.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int REPS = 20000;
+
+//-----------------------------------------------
+struct Timing
+{
+    double ns;
+    double ticks;
+};
+//-----------------------------------------------
+template<typename L>
+static Timing sweep(const L& l, long& sum)
+{
+    Timing t = { 0, 0 };
+    auto t0 = Clock::now();
+#if HAVE_TSC
+    auto c0 = __rdtsc();
+#endif
+    for (int r = 0; r < REPS; ++r)
+        for (uint16_t c = 0; c < 1024; ++c)
+            sum += l.raw(c);
+#if HAVE_TSC
+    t.ticks = double(__rdtsc() - c0) / (1024.0 * REPS);
+#endif
+    t.ns = std::chrono::duration<double>(Clock::now() - t0).count() / (1024.0 * REPS) * 1e9;
+    return t;
+}
+//-----------------------------------------------
+int main()
+{
+    const auto& plain = TempTable100kB3950x128::_instance;
+    const auto& slope = TempTable100kB3950x128Slope::_instance;
+
+    int maxDiff = 0;
+    for (uint16_t c = 0; c < 1024; ++c)
+    {
+        int d = abs(plain.raw(c) - slope.raw(c));
+        if (d > maxDiff)
+            maxDiff = d;
+    }
+
+    long sum = 0;
+    Timing tp = sweep(plain, sum);
+    Timing ts = sweep(slope, sum);
+
+    printf("layout     table bytes  ns/op  tsc ticks/op\n");
+    printf("plain      %11u  %5.2f  %6.2f\n", unsigned(32 * sizeof(int16_t)), tp.ns, tp.ticks);
+    printf("base+slope %11u  %5.2f  %6.2f\n", unsigned(32 * sizeof(SlopeEntry<int16_t>)), ts.ns, ts.ticks);
+    printf("max |difference| %d raw (%.4fC)\n", maxDiff, maxDiff / 128.0);
+    printf("(checksum %ld)\n", sum);
+    return 0;
+}
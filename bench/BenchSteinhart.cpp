@@ -0,0 +1,150 @@
+/** @file
+    Host benchmark: Steinhart-Hart against Beta for a 100k NTC on a 100k
+    load and a 10 bit ADC. The reference curve is a Steinhart-Hart set
+    typical of a 100k glass NTC; its datasheet style B25/85 is taken from
+    the same curve.
+
+    - model error: Beta (B25/85) and Steinhart-Hart fitted through three
+      points, and by least squares through eleven noisy ones, against
+      the reference from -40C to 150C;
+    - table error: each model as a 2^bits entry interpolated x128 table,
+      over the counts for -20C..100C, so the coarsest table that still
+      meets a tolerance can be read off;
+    - runtime: Thermistor, ThermistorFloat and ThermistorFixed set up
+      with the fitted coefficients, ns/op and error against the double
+      model.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchSteinhart.cpp src/Thermistor.cpp src/ThermistorFixed.cpp -o benchSteinhart
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SteinhartHart.h"
+#include "Thermistor.h"
+#include "ThermistorFixed.h"
+#include "ThermistorFloat.h"
+
+typedef std::chrono::steady_clock Clock;
+typedef SteinhartHart<double> SH;
+
+static const double RL = 100000;
+static const SH REF = { 8.11290160145e-4, 2.11355789144e-4, 7.2058993e-8 };
+
+//-----------------------------------------------
+/// Thermistor resistance for counts, thermistor on the high side
+static double ohms(double c)
+{
+    return RL * (1023.0 / c - 1);
+}
+//-----------------------------------------------
+static double counts(double r)
+{
+    return 1023.0 * RL / (RL + r);
+}
+//-----------------------------------------------
+/// Worst |model - REF| from -40C to 150C, in C
+static double modelError(const SH& m)
+{
+    double e = 0;
+    for (double t = -40; t <= 150; t += 0.25)
+        e = fmax(e, fabs(m.tempFromResistance(REF.resistanceAtTemp(t)) - t));
+    return e;
+}
+//-----------------------------------------------
+/// Worst error of an interpolated x128 table from a model, against REF, -20C..100C
+static double tableError(const SH& m, int bits)
+{
+    const int rbits = 10 - bits;
+    int16_t table[1 << 10];
+    for (int i = 0; i < 1 << bits; ++i)
+    {
+        double c = i == 0 ? 0.5 * (1 << rbits) : i << rbits;
+        table[i] = int16_t(m.tempFromResistance(ohms(c)) * 128 + 0.5);
+    }
+
+    double e = 0;
+    int c0 = int(ceil(counts(REF.resistanceAtTemp(-20))));
+    int c1 = int(counts(REF.resistanceAtTemp(100)));
+    for (int c = c0; c <= c1; ++c)
+    {
+        int ix = c >> rbits, res = c & ((1 << rbits) - 1);
+        int v = table[ix] + (((table[ix + 1] - table[ix]) * res) >> rbits);
+        e = fmax(e, fabs(v / 128.0 - REF.tempFromResistance(ohms(c))));
+    }
+    return e;
+}
+//-----------------------------------------------
+template<typename F>
+static void run(const char* name, const SH& m, F f)
+{
+    double sum = 0;
+    const int reps = 20000;
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; ++r)
+        for (int c = 1; c < 1023; ++c)
+            sum += f(c);
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (1022.0 * reps) * 1e9;
+
+    double e = 0;
+    for (int c = 1; c < 1023; ++c)
+    {
+        double t = m.tempFromResistance(ohms(c));
+        if (t >= -40 && t <= 150)
+            e = fmax(e, fabs(f(c) - t));
+    }
+    printf("  %-16s %6.2f ns/op  max %.4fC  (checksum %.0f)\n", name, ns, e, sum);
+}
+//-----------------------------------------------
+int main()
+{
+    // B25/85, as a datasheet quotes it
+    double r25 = REF.resistanceAtTemp(25), r85 = REF.resistanceAtTemp(85);
+    double beta = log(r25 / r85) / (1 / 298.15 - 1 / 358.15);
+    SH bm = SH::fromBeta(r25, beta);
+
+    const double t3[] = { -20, 25, 85 };
+    double r3[3];
+    for (int i = 0; i < 3; ++i)
+        r3[i] = REF.resistanceAtTemp(t3[i]);
+    SH sh3, sh11;
+    bool ok = SH::fit(t3, r3, 3, sh3);
+
+    // eleven points, 0.05C of calibration bath noise
+    double t11[11], r11[11];
+    srand(1);
+    for (int i = 0; i < 11; ++i)
+    {
+        double t = -40 + i * 19;
+        t11[i] = t + (rand() / double(RAND_MAX) - 0.5) * 0.1;
+        r11[i] = REF.resistanceAtTemp(t);
+    }
+    ok = SH::fit(t11, r11, 11, sh11) && ok;
+
+    printf("model error, -40C..150C\n");
+    printf("  Beta B25/85=%.1f          %.4fC\n", beta, modelError(bm));
+    printf("  SH fit, 3 points            %.4fC  (A=%.6e B=%.6e C=%.6e)\n", modelError(sh3), sh3.a, sh3.b, sh3.c);
+    printf("  SH fit, 11 noisy points     %.4fC\n", modelError(sh11));
+
+    printf("\ninterpolated table error against the reference, -20C..100C\n");
+    printf("  bits  entries  bytes    Beta      SH\n");
+    for (int bits = 7; bits >= 3; --bits)
+        printf("  %4d  %7d  %5d  %7.4fC  %7.4fC\n", bits, 1 << bits, 2 << bits, tableError(bm, bits), tableError(sh3, bits));
+
+    printf("\nruntime classes with the 3 point fit, against the double model\n");
+    SteinhartHart<float> shf = { float(sh3.a), float(sh3.b), float(sh3.c) };
+    Thermistor th;
+    th._rl = RL;
+    th._vAdcMax = 3.3;
+    th._vDrive = 3.3;
+    th._sh = shf;
+    ThermistorFloat tf(shf, RL);
+    ThermistorFixed fx(th, 128);
+    run("Thermistor", sh3, [&](int c) { return double(th.tempFromCounts(c)); });
+    run("ThermistorFloat", sh3, [&](int c) { return double(tf.tempFromCounts(c)); });
+    run("ThermistorFixed", sh3, [&](int c) { return fx.raw(c) / 128.0; });
+
+    return !ok;
+}
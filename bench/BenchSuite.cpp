@@ -0,0 +1,284 @@
+/** @file
+    Host benchmark suite: every conversion path in the library, each over
+    an exhaustive sweep (every input code in range) and a realistic one
+    (a slow drift with a few counts of noise, as a sensor produces).
+
+    For each path and sweep: ns/op, ops/s, and the max and mean absolute
+    error against a double precision reference of the same model, taken
+    over the inputs the path claims to be accurate for (clamped ends
+    excluded).
+
+    Thermistor paths are all 100k/3950 on a 10 bit ADC with a 100k load;
+    HS1101 paths use each data class's own thermistor and oscillator.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc bench/BenchSuite.cpp src/Thermistor.cpp src/TempTable100kB3950x1*.cpp src/HS1101Rt*.cpp -o benchSuite
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "Thermistor.h"
+#include "ThermistorFloat.h"
+#include "ThermistorTable.h"
+#include "TempTable100kB3950x100.h"
+#include "TempTable100kB3950x128.h"
+#include "TempTable100kB3950x128Knots.h"
+#include "TempTable100kB3950x128Slope.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110Packed.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.h"
+#include "HS1101Rt100k0Rs152k5Tl_10Th50Cstray7_2.h"
+
+typedef std::chrono::steady_clock Clock;
+
+/// Lookups per timed run, whatever the sweep length
+static const long OPS = 20000000;
+
+static volatile long sink;
+
+//-----------------------------------------------
+//-----------------------------------------------
+/// Double precision models, as in thermgen.py and hs1101.py
+struct Reference
+{
+    //---------------------------------------------------------
+    /// Beta equation, thermistor on the high side of the divider
+    static double temp(double counts, double rl, double rth = 100000, double beta = 3950)
+    {
+        double r = rl * (1023.0 / counts - 1);
+        return 1 / (1 / 298.15 + log(r / rth) / beta) - 273.15;
+    }
+    //---------------------------------------------------------
+    /// RH% for oscillator counts at a temperature, clipped as computeRH() does
+    static double rh(double counts, double temp, double cStrayPf, double rOsc = 402700)
+    {
+        double cap = 0.725 / (rOsc * counts) * 1e12 - cStrayPf;
+        double c = 180 + temp * 0.04;
+        double lo = -200, hi = 200;
+        for (int i = 0; i < 60; ++i)
+        {
+            double m = (lo + hi) / 2;
+            double f = c * (1.25e-7 * m * m * m - 1.36e-5 * m * m + 2.19e-3 * m + 0.9) - cap;
+            if (f < 0)
+                lo = m;
+            else
+                hi = m;
+        }
+        double r = (lo + hi) / 2;
+        return r < 0 ? 0 : r > 100 ? 100 : r;
+    }
+    //---------------------------------------------------------
+};
+
+//-----------------------------------------------
+//-----------------------------------------------
+/// One input; x is the ADC or oscillator count, y the raw temperature for computeRH
+struct Sample
+{
+    uint16_t x;
+    int16_t y;
+    bool check; ///< in the path's accurate range
+    double ref;
+};
+
+typedef std::vector<Sample> Sweep;
+
+//-----------------------------------------------
+/// LCG, so every run sees the same "realistic" inputs
+static uint32_t rnd()
+{
+    static uint32_t s = 12345;
+    s = s * 1664525u + 1013904223u;
+    return s >> 8;
+}
+//-----------------------------------------------
+/// Every count from lo to hi
+static Sweep exhaustive(int lo, int hi)
+{
+    Sweep s;
+    for (int c = lo; c <= hi; ++c)
+        s.push_back(Sample{ uint16_t(c), 0, false, 0 });
+    return s;
+}
+//-----------------------------------------------
+/// Slow drift over lo..hi with +-noise counts on top
+static Sweep drift(int lo, int hi, int noise, size_t n = 4096)
+{
+    Sweep s;
+    double v = (lo + hi) / 2.0, dv = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        dv = 0.98 * dv + ((rnd() % 201) - 100) * 0.002;
+        v += dv;
+        if (v < lo) { v = lo; dv = -dv; }
+        if (v > hi) { v = hi; dv = -dv; }
+        int c = int(v + 0.5) + int(rnd() % (2 * noise + 1)) - noise;
+        c = c < 0 ? 0 : c > 65535 ? 65535 : c;
+        s.push_back(Sample{ uint16_t(c), 0, false, 0 });
+    }
+    return s;
+}
+//-----------------------------------------------
+/**
+    Time f over the sweep and compare it with the reference.
+    @param unit     "C" or "RH%"
+    @param scale    Result to unit factor
+ */
+template<typename F>
+static void run(const char* path, const char* sweep, const Sweep& s, F f, double scale, const char* unit)
+{
+    long reps = OPS / long(s.size()) + 1;
+    long sum = 0;
+    auto t0 = Clock::now();
+    for (long r = 0; r < reps; ++r)
+        for (const Sample& x : s)
+            sum += long(f(x));
+    double ns = std::chrono::duration<double>(Clock::now() - t0).count() / (double(reps) * s.size()) * 1e9;
+    sink = sink + sum;
+
+    double maxErr = 0, sumErr = 0;
+    long n = 0;
+    for (const Sample& x : s)
+    {
+        if (!x.check)
+            continue;
+        double e = fabs(f(x) * scale - x.ref);
+        sumErr += e;
+        if (e > maxErr)
+            maxErr = e;
+        ++n;
+    }
+    printf("%-50s %-10s %7.2f %9.2f  %8.4f %8.4f %s\n",
+        path, sweep, ns, 1e3 / ns, maxErr, n ? sumErr / n : 0, unit);
+}
+
+//-----------------------------------------------
+//-----------------------------------------------
+/// Thermistor sweeps; accurate over lo..hi
+static Sweep thermSweep(bool realistic, int lo, int hi, double rl = 100000)
+{
+    // 10C..40C is roughly 280..780 counts for 100k/100k
+    Sweep s = realistic ? drift(280, 780, 3) : exhaustive(0, 1023);
+    for (Sample& x : s)
+    {
+        x.check = x.x >= lo && x.x <= hi;
+        x.ref = x.check ? Reference::temp(x.x, rl) : 0;
+    }
+    return s;
+}
+//-----------------------------------------------
+template<typename L>
+static void table(const char* name, const L& l, int lo, int hi)
+{
+    for (int realistic = 0; realistic < 2; ++realistic)
+        run(name, realistic ? "realistic" : "exhaustive", thermSweep(realistic, lo, hi),
+            [&](const Sample& x) { return l.raw(x.x); }, 1.0 / l.getScale(), "C");
+}
+//-----------------------------------------------
+static void thermistors()
+{
+    // ratiometric, so the counts -> volts -> ohms chain matches the tables
+    Thermistor th;
+    th._rl = 100000;
+    th._vAdcMax = 3.3;
+    th._vDrive = 3.3;
+    ThermistorFloat tf(100000, 3950, 100000);
+
+    // float results are scaled up so the checksum sees the fraction
+    for (int realistic = 0; realistic < 2; ++realistic)
+    {
+        const char* sw = realistic ? "realistic" : "exhaustive";
+        run("Thermistor::tempFromCounts", sw, thermSweep(realistic, 1, 1022),
+            [&](const Sample& x) { return th.tempFromCounts(x.x) * 1024; }, 1.0 / 1024, "C");
+        run("ThermistorFloat::tempFromCounts", sw, thermSweep(realistic, 1, 1022),
+            [&](const Sample& x) { return tf.tempFromCounts(x.x) * 1024; }, 1.0 / 1024, "C");
+    }
+
+    // first and last buckets are clamp values
+    table("TempTable100kB3950x100::raw", TempTable100kB3950x100::_instance, 32, 991);
+    table("TempTable100kB3950x128::raw", TempTable100kB3950x128::_instance, 32, 991);
+    table("TempTable100kB3950x128Slope::raw", TempTable100kB3950x128Slope::_instance, 32, 991);
+
+    const auto& knots = TempTable100kB3950x128Knots::_instance;
+    table("TempTable100kB3950x128Knots::raw", knots,
+        knots.table()[0].count, knots.table()[knots.knots() - 1].count);
+
+    typedef TempTable<100000, 3950, 100000, 10, 5, false, 128> Compiled;
+    table("TempTable<..., 5, x128>::raw", Compiled::_instance, 32, 991);
+
+    // above 1019 counts x128 overflows int16_t and saturates
+    typedef DirectTempTable<100000, 3950, 100000, 10, false, 128> Direct;
+    table("DirectTempTable<..., x128>::raw", Direct::_instance, 1, 1019);
+}
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    rawTemp() and computeRH() for one generated data class.
+    @param rs       Thermistor load resistor
+    @param cStray   Stray capacitance the table was generated with, pF
+ */
+template<typename H>
+static void hs1101(const char* name, double rs, double cStray)
+{
+    H h;
+    char path[64];
+    const double tScale = 1.0 / H::_therm_table_scale;
+
+    for (int realistic = 0; realistic < 2; ++realistic)
+    {
+        const char* sw = realistic ? "realistic" : "exhaustive";
+        Sweep s = thermSweep(realistic, H::_therm_table_locount, H::_therm_table_hicount, rs);
+        snprintf(path, sizeof(path), "%s::rawTemp", name);
+        run(path, sw, s, [&](const Sample& x) { return h.rawTemp(x.x); }, tScale, "C");
+    }
+
+    // counts over the table, temperatures every quarter degree over its
+    // rows; the end counts are clamp values
+    Sweep ex;
+    for (int t = H::_humid_table_tminsc; t <= H::_humid_table_tmaxsc; t += H::_therm_table_scale / 4)
+        for (int c = H::_humid_table_locount; c <= H::_humid_table_hicount; c += 7)
+            ex.push_back(Sample{ uint16_t(c), int16_t(t),
+                c > H::_humid_table_locount && c < H::_humid_table_hicount, 0 });
+
+    // humidity wanders, temperature drifts slowly around 20C
+    Sweep re = drift(H::_humid_table_locount, H::_humid_table_hicount, 20);
+    for (size_t i = 0; i < re.size(); ++i)
+    {
+        re[i].y = int16_t((20 + 5 * sin(i * 0.002)) * H::_therm_table_scale);
+        re[i].check = re[i].x > H::_humid_table_locount && re[i].x < H::_humid_table_hicount;
+    }
+
+    for (Sweep* s : { &ex, &re })
+        for (Sample& x : *s)
+            x.ref = x.check ? Reference::rh(x.x, x.y * tScale, cStray) : 0;
+
+    auto rh = [&](const Sample& x)
+    {
+        int16_t raw;
+        h.computeRH(x.x, x.y, raw);
+        return raw;
+    };
+    snprintf(path, sizeof(path), "%s::computeRH", name);
+    run(path, "exhaustive", ex, rh, 1.0 / H::_humid_table_scale, "RH%");
+    run(path, "realistic", re, rh, 1.0 / H::_humid_table_scale, "RH%");
+}
+//-----------------------------------------------
+int main()
+{
+    printf("%-50s %-10s %7s %9s  %8s %8s\n", "path", "sweep", "ns/op", "Mops/s", "max err", "mean err");
+
+    thermistors();
+
+    hs1101<HS1101Rt100k0Rs100k0Tl_10Th110>("HS1101Rt100k0Rs100k0Tl_10Th110", 100000, 0);
+    hs1101<HS1101Rt100k0Rs100k0Tl_10Th110Packed>("HS1101Rt100k0Rs100k0Tl_10Th110Packed", 100000, 0);
+    hs1101<HS1101Rt100k0Rs150k0Tl_10Th110>("HS1101Rt100k0Rs150k0Tl_10Th110", 150000, 0);
+    hs1101<HS1101Rt100k0Rs150k0Tl_10Th50>("HS1101Rt100k0Rs150k0Tl_10Th50", 150000, 8);
+    hs1101<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2>("HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2", 150000, 8);
+    hs1101<HS1101Rt100k0Rs152k5Tl_10Th50Cstray7_2>("HS1101Rt100k0Rs152k5Tl_10Th50Cstray7_2", 152500, 7.2);
+    return 0;
+}
@@ -0,0 +1,120 @@
+/** @file
+    Host benchmark: HS1101Sweep over a board revision's worth of choices
+    (load resistor, stray capacitance, temperature range, row and column
+    steps, scales, pow2). Times the sweep serially and with a thread per
+    core, prints the Pareto front, and checks the sweep's emulated
+    computeRH()/rawTemp() error against the real HS1101 class for the
+    compiled in HS1101Rt100k0Rs100k0Tl_10Th110 and ...Cstray8P2 tables.
+
+    Build (from the repo root):
+        g++ -O2 -pthread -Isrc bench/BenchSweep.cpp src/HS1101Sweep.cpp src/HS1101Generator.cpp src/CalImage.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp src/HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.cpp -o benchSweep
+    Run: ./benchSweep [front.csv]
+ */
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+#include "HS1101Sweep.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.h"
+
+typedef std::chrono::steady_clock Clock;
+
+//-----------------------------------------------
+static double ms(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count() * 1e3;
+}
+//-----------------------------------------------
+/// Worst RH and temperature error of a compiled class, on the grid evaluate() samples
+template<typename H>
+static void actual(H& h, const HS1101GenParams& p, int samples, double& rhErr, double& tempErr)
+{
+    HS1101Generator g(p);
+    g.generate(1);
+    rhErr = tempErr = 0;
+
+    int thi = g.thermHiCount() < 1023 ? g.thermHiCount() : 1023;
+    for (int adc = g.thermLoCount() + 1; adc < thi; ++adc)
+        tempErr = fmax(tempErr, fabs(H::scaleTemp(h.rawTemp(adc)) - g.tempForCounts(adc)));
+
+    int stepTsc = p.tstep * p.tscale;
+    for (int t = p.tmin * p.tscale; t <= p.tmax * p.tscale; t += stepTsc / samples)
+        for (int c = p.fcmin + 1; c < p.fcmax; c += p.fcstep / samples)
+        {
+            int16_t raw;
+            h.computeRH(c, t, raw);
+            double m = HS1101Generator::rhFromCapTemp(g.capFromCounts(c), double(t) / p.tscale);
+            m = m < 0 ? 0 : m > 100 ? 100 : m;
+            rhErr = fmax(rhErr, fabs(H::scaleHumid(raw) - m));
+        }
+}
+//-----------------------------------------------
+template<typename H>
+static int check(const char* name, const HS1101GenParams& p)
+{
+    HS1101SweepSpace s;
+    s.fitCounts = false;
+    HS1101Sweep sweep(s);
+    HS1101SweepResult r = sweep.evaluate(p);
+
+    H h;
+    double rhErr, tempErr;
+    actual(h, r.params, 8, rhErr, tempErr);
+    bool same = r.valid && r.rhErr == rhErr && r.tempErr == tempErr;
+    printf("%-40s sweep %.4f RH%% %.4f C, compiled %.4f RH%% %.4f C, %u bytes, ~%u cycles %s\n",
+        name, r.rhErr, r.tempErr, rhErr, tempErr, r.bytes, r.cycles, same ? "ok" : "MISMATCH");
+    return !same;
+}
+//-----------------------------------------------
+int main(int argc, char** argv)
+{
+    int bad = 0;
+    HS1101GenParams p;
+    bad += check<HS1101Rt100k0Rs100k0Tl_10Th110>("HS1101Rt100k0Rs100k0Tl_10Th110", p);
+    p.rsense = 150000;
+    p.tmax = 50;
+    p.cStrayPf = 8;
+    p.pow2 = true;
+    bad += check<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2>("HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2", p);
+
+    HS1101SweepSpace s;
+    s.rsense = { 100000, 120000, 150000, 152500 };
+    s.cStrayPf = { 0, 4, 7.2, 8 };
+    s.tmax = { 50, 85, 110 };
+    s.tstep = { 5, 10, 20 };
+    s.tscale = { 100, 127 };
+    s.fcstep = { 50, 100, 200 };
+    s.hscale = { 128, 256 };
+    s.pow2 = { false, true };
+    HS1101Sweep sweep(s);
+
+    std::vector<HS1101SweepResult> all;
+    const unsigned threads[] = { 1, 0 };
+    for (unsigned th : threads)
+    {
+        auto t0 = Clock::now();
+        all = sweep.run(th);
+        double t = ms(t0);
+        printf("%zu combinations, %zu candidates, %s: %.0f ms (%.2f ms each)\n",
+            sweep.size(), all.size(), th == 1 ? "1 thread " : "per core", t, t / all.size());
+    }
+
+    auto t0 = Clock::now();
+    std::vector<HS1101SweepResult> front = HS1101Sweep::pareto(all);
+    printf("pareto front: %zu of %zu in %.1f ms\n\n", front.size(), all.size(), ms(t0));
+
+    std::string csv = HS1101Sweep::csv(front);
+    if (argc > 1)
+    {
+        FILE* f = fopen(argv[1], "w");
+        if (f)
+        {
+            fputs(csv.c_str(), f);
+            fclose(f);
+        }
+    }
+    else
+        fputs(csv.c_str(), stdout);
+    return bad;
+}
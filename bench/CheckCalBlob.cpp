@@ -0,0 +1,93 @@
+/** @file
+    Host check: Thermistor::load() of /cal.bin blobs.
+
+    - a version 1 blob, laid out as the original Thermistor (no
+      Steinhart-Hart, _majick2 last), loads with its values and Beta;
+    - a current blob round trips with its coefficients;
+    - wrong sizes, magic or version are refused and leave the defaults.
+
+    Build (from the repo root):
+        g++ -O2 -Wall -Isrc bench/CheckCalBlob.cpp src/Thermistor.cpp -o checkCalBlob
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "Thermistor.h"
+
+/// The blob as firmware before Steinhart-Hart saved it
+struct ThermistorV1
+{
+    uint32_t _majick1;
+    float _rth;
+    float _beta;
+    float _rl;
+    float _vAdcMax;
+    float _vDrive;
+    float _offset;
+    bool _invert;
+    int _adcCountMax;
+    uint32_t _majick2;
+};
+
+static int failures;
+
+//-----------------------------------------------
+static void check(bool ok, const char* what)
+{
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+//-----------------------------------------------
+static ThermistorV1 v1Blob()
+{
+    Thermistor d;
+    ThermistorV1 b;
+    memset(&b, 0, sizeof(b));
+    b._majick1 = d._majick1;
+    b._rth = 47000;
+    b._beta = 4050;
+    b._rl = 22000;
+    b._vAdcMax = 1.1f;
+    b._vDrive = 3.3f;
+    b._offset = -0.25f;
+    b._invert = true;
+    b._adcCountMax = 1023;
+    b._majick2 = d._majick2;
+    return b;
+}
+//-----------------------------------------------
+int main()
+{
+    printf("version 1 blob, %u bytes\n", unsigned(sizeof(ThermistorV1)));
+    check(Thermistor::sizeV1() == sizeof(ThermistorV1), "version 1 layout kept at the front");
+
+    ThermistorV1 b1 = v1Blob();
+    Thermistor t;
+    bool ok = t.load(&b1, sizeof(b1));
+    check(ok && t._rth == 47000 && t._beta == 4050 && t._rl == 22000 && t._invert
+        && t._offset == -0.25f, "loads, with its values");
+    check(!t._sh.isSet() && t._version == Thermistor::blobVersion, "Beta, and current once loaded");
+    Thermistor beta = t;
+    beta._sh = SteinhartHart<float>::fromBeta(47000, 4050);
+    check(fabsf(t.tempFromCounts(500) - beta.tempFromCounts(500)) < 0.01f, "converts as Beta");
+
+    printf("current blob, %u bytes\n", unsigned(sizeof(Thermistor)));
+    Thermistor s;
+    s._sh = SteinhartHart<float>{ 7.0e-4f, 2.2e-4f, 9.0e-8f };
+    Thermistor u;
+    check(u.load(&s, sizeof(s)) && u._sh.a == s._sh.a && u._sh.c == s._sh.c, "round trips with Steinhart-Hart");
+
+    printf("bad blobs\n");
+    Thermistor v;
+    check(!v.load(&b1, sizeof(b1) - 1) && !v.load(&s, sizeof(s) + 1), "other sizes refused");
+    ThermistorV1 bad = b1;
+    bad._majick2 = 0;
+    check(!v.load(&bad, sizeof(bad)) && v._rth == Thermistor()._rth, "bad magic refused, defaults kept");
+    Thermistor w = s;
+    w._version = Thermistor::blobVersion + 1;
+    check(!v.load(&w, sizeof(w)) && !v._sh.isSet(), "unknown version refused");
+
+    printf("%d failed\n", failures);
+    return failures;
+}
@@ -0,0 +1,330 @@
+/** @file
+    Host simulation: HumidATtiny3216 (the real humid.cpp) on the timer
+    model in bench/sim, checking the blocking and the callback driven
+    counting and how they schedule against the main loop:
+
+    - blocking gate: endCounting() sleeps the 1s window away and returns
+      the edges in it;
+    - callback gate: the main loop keeps working in 10ms slices through
+      the window, the callback fires once at 1s, takeCounts() gives the
+      same counts once and then nothing;
+    - callback reciprocal: the sample is in within a few slices, and
+      scaled by the periods it was started with if setReciprocal()
+      changes under it;
+    - stopped oscillator: reciprocal mode times out on the RTC window,
+      with the callback and 0 counts;
+    - back to back samples restarted from the main loop;
+    - calibrateClock() with CLK_PER 2% off F_CPU;
+    - continuous windows: a main loop 3.5s late loses nothing, the
+      windows add up to every edge since the start (TCA0 wrapping at
+      40kHz), and one 12s late drops what the queue can't hold;
+    - 32 bit counts: a 100kHz gate through TCA0's overflow, the 16 bit
+      call saturating, and the counts through the counts32 table against
+      the 16 bit one at a tenth of them;
+    - an overflow still pending when the RTC ISR reads the count;
+    - the thermistor converted through the gate on PIT events: one
+      wake gives the counts and a 4 bit oversampled reading, and ADC0
+      goes back to how the application had it; calibrateClock() converts
+      nothing; noThermistor part way through a sample gives ADC0 back
+      there and then, and turns the PIT and its event channel off.
+
+    Build (from the repo root):
+        g++ -O2 -Isrc -Ibench/sim -DHUMID_RECIPROCAL=1 -DHUMID_COUNT32=1 -DHUMID_THERMISTOR=1 bench/SimHumid.cpp bench/sim/SimAvr.cpp src/humid.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110.cpp src/HS1101Rt100k0Rs100k0Tl_10Th110Ro40k3W32.cpp -o simHumid
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "humid.h"
+#include "HS1101.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110.h"
+#include "HS1101Rt100k0Rs100k0Tl_10Th110Ro40k3W32.h"
+
+typedef HumidATtiny3216 H;
+
+static const double SLICE = 0.01;   ///< main loop work unit, s
+
+static int failures;
+static volatile unsigned callbacks;
+static double doneAt;       ///< time of the last callback
+
+//-----------------------------------------------
+static void check(bool ok, const char* what)
+{
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+//-----------------------------------------------
+static void done()
+{
+    ++callbacks;
+    doneAt = Sim::now;
+}
+//-----------------------------------------------
+static void start(double clkHz, double oscHz, uint8_t periods)
+{
+    Sim::reset(clkHz, oscHz);
+    Sim::oscPhase = 0.37 / oscHz;
+    H::init();
+    H::setReciprocal(periods);
+    callbacks = 0;
+}
+//-----------------------------------------------
+/// Main loop slices until the callback, then the sample
+static unsigned overlap(uint16_t& counts, bool& taken)
+{
+    unsigned slices = 0;
+    while (!callbacks && slices < 1000)
+    {
+        Sim::run(SLICE);
+        ++slices;
+    }
+    taken = H::takeCounts(counts);
+    return slices;
+}
+//-----------------------------------------------
+static void blockingGate()
+{
+    printf("blocking gate, 9700Hz\n");
+    start(F_CPU, 9700, 0);
+    double t0 = Sim::now;
+    H::beginCounting();
+    uint16_t c = H::endCounting();
+    double dt = Sim::now - t0;
+    printf("    %u counts in %.3fs, %u sleeps\n", c, dt, Sim::sleeps);
+    check(fabs(dt - 1) < 1e-6, "endCounting() returns at the end of the 1s window");
+    check(c == Sim::edges(t0, t0 + 1), "counts are the edges in the window");
+    uint16_t again;
+    check(!H::takeCounts(again), "endCounting() took the sample");
+}
+//-----------------------------------------------
+static void callbackGate()
+{
+    printf("callback gate, 9700Hz\n");
+    start(F_CPU, 9700, 0);
+    double t0 = Sim::now;
+    H::beginCounting(done);
+    uint16_t c = 0, again;
+    bool taken;
+    unsigned slices = overlap(c, taken);
+    printf("    %u counts, %u main loop slices during the window, %u sleeps\n", c, slices, Sim::sleeps);
+    check(slices >= 99 && Sim::sleeps == 0, "main loop ran through the window");
+    check(callbacks == 1, "callback fired once");
+    check(taken && c == Sim::edges(t0, t0 + 1), "takeCounts() has the gate's counts");
+    check(!H::takeCounts(again), "takeCounts() gives a sample once");
+    check(!H::isCounting(), "not counting after");
+}
+//-----------------------------------------------
+static void callbackReciprocal()
+{
+    printf("callback reciprocal, 64 periods, 10123.4Hz\n");
+    start(F_CPU, 10123.4, 64);
+    double t0 = Sim::now;
+    H::beginCounting(done);
+    uint16_t c = 0;
+    bool taken;
+    unsigned slices = overlap(c, taken);
+    printf("    %u counts after %u slices, %u TCB0 ISRs, sample in at %.2fms\n",
+        c, slices, Sim::tcbIsrs, 1e3 * (doneAt - t0));
+    check(slices == 1, "in within one 10ms slice");
+    check(taken && abs(int(c) - 10123) <= 1, "1s equivalent counts");
+    check(Sim::tcbIsrs == 65, "partial period plus 64 captures");
+    Sim::run(2);
+    check(callbacks == 1 && Sim::rtcIsrs == 0, "timeout disarmed once done");
+
+    callbacks = 0;
+    H::beginCounting(done);
+    H::setReciprocal(16);       // for the next sample
+    overlap(c, taken);
+    H::setReciprocal(64);
+    check(taken && abs(int(c) - 10123) <= 1, "setReciprocal() mid sample doesn't rescale it");
+}
+//-----------------------------------------------
+static void stopped()
+{
+    printf("reciprocal with the oscillator stopped\n");
+    start(F_CPU, 0, 64);
+    H::beginCounting(done);
+    uint16_t c = 1;
+    bool taken;
+    unsigned slices = overlap(c, taken);
+    check(slices == 100 && callbacks == 1, "times out on the 1s window, with the callback");
+    check(taken && c == 0, "0 counts, i.e. HumidityLow");
+}
+//-----------------------------------------------
+static void backToBack()
+{
+    printf("back to back reciprocal samples from the main loop, 32 periods\n");
+    start(F_CPU, 8800, 32);
+    double t0 = Sim::now;
+    unsigned samples = 0, bad = 0;
+    H::beginCounting(done);
+    while (samples < 20)
+    {
+        Sim::run(0.001);
+        uint16_t c;
+        if (H::takeCounts(c))
+        {
+            bad += abs(int(c) - 8800) > 1;
+            ++samples;
+            H::beginCounting(done);
+        }
+    }
+    double dt = Sim::now - t0;
+    printf("    20 samples in %.1fms\n", dt * 1e3);
+    check(bad == 0 && callbacks == 20, "every sample taken, within a count");
+    check(dt < 20 * 0.006, "no gate sized gaps");
+}
+//-----------------------------------------------
+static void calibration()
+{
+    printf("CLK_PER 2%% fast, 64 periods, 10000Hz\n");
+    start(F_CPU * 1.02, 10000, 64);
+    H::beginCounting();
+    uint16_t before = H::endCounting();
+    H::calibrateClock();
+    H::beginCounting();
+    uint16_t after = H::endCounting();
+    printf("    before %u, after %u\n", before, after);
+    check(abs(int(before) - 9804) <= 1, "uncalibrated reads low by the clock error");
+    check(abs(int(after) - 10000) <= 1, "calibrated to a count");
+}
+//-----------------------------------------------
+static void continuous()
+{
+    printf("continuous windows, 40000.3Hz (TCA0 wraps each 1.6s)\n");
+    start(F_CPU, 40000.3, 0);
+    double t0 = Sim::now;
+    H::beginContinuous(done);
+    Sim::run(3.5);      // main loop busy elsewhere
+
+    uint32_t sum = 0;
+    unsigned n = 0, bad = 0;
+    uint16_t c;
+    while (H::takeWindow(c))
+    {
+        sum += c;
+        bad += c < 40000 || c > 40001;
+        ++n;
+    }
+    printf("    %u windows, %lu counts\n", n, (unsigned long)sum);
+    check(n == 3 && callbacks == 3 && bad == 0, "a window per second, queued while the loop was late");
+    check(sum == Sim::edges(t0, t0 + 3), "every edge in exactly one window");
+
+    Sim::run(12);
+    n = 0;
+    while (H::takeWindow(c))
+        ++n;
+    printf("    12s later: %u windows queued, %u dropped\n", n, H::windowsDropped());
+    check(n == H::windowQueue && H::windowsDropped() == 12 - H::windowQueue, "queue full, the rest counted as dropped");
+
+    Sim::run(2);
+    H::endContinuous();
+    n = 0;
+    while (H::takeWindow(c))
+        ++n;
+    Sim::run(3);
+    check(n == 2 && !H::takeWindow(c) && Sim::rtcIsrs == 17, "stops at endContinuous()");
+}
+//-----------------------------------------------
+static void wideGate()
+{
+    printf("32 bit gate, 100000.7Hz on the 40k3 timing resistor\n");
+    start(F_CPU, 100000.7, 0);
+    double t0 = Sim::now;
+    H::beginCounting();
+    uint32_t c = H::endCounting32();
+    printf("    %lu counts, %u TCA0 overflows\n", (unsigned long)c, Sim::tcaIsrs);
+    check(c == Sim::edges(t0, t0 + 1) && Sim::tcaIsrs == 1, "endCounting32() has every edge");
+    H::beginCounting();
+    check(H::endCounting() == 0xffff, "endCounting() saturates");
+
+    typedef HS1101Rt100k0Rs100k0Tl_10Th110Ro40k3W32Data W;
+    typedef HS1101Rt100k0Rs100k0Tl_10Th110Data N;
+    HS1101<W> wide;
+    HS1101<N> narrow;
+    int16_t rw, rn;
+    const int16_t t = int16_t(25 * W::_therm_table_scale);
+    bool ok = wide.computeRH(c, t, rw) == HS1101<W>::Status::Ok
+        && narrow.computeRH(uint16_t((c + 5) / 10), t, rn) == HS1101<N>::Status::Ok;
+    printf("    %.2f RH%% at 25C, 16 bit table %.2f\n", W::scaleHumid(rw), N::scaleHumid(rn));
+    check(ok && abs(rw - rn) <= 8, "counts32 table agrees with the 16 bit one");
+}
+//-----------------------------------------------
+static void pendingOverflow()
+{
+    printf("continuous, 65536.5Hz: TCA0 wraps just before the window ends\n");
+    start(F_CPU, 65536.5, 0);
+    double t0 = Sim::now;
+    H::beginContinuous();
+    Sim::run(0.999);
+    cli();              // main loop in a critical section over both
+    Sim::run(0.002);
+    double late = Sim::now;
+    sei();              // RTC ISR first, TCA0 overflow still pending
+    uint32_t c = 0;
+    bool taken = H::takeWindow(c);
+    H::endContinuous();
+    printf("    window %lu counts, closed %.0fms late\n", (unsigned long)c, 1e3 * (late - t0 - 1));
+    check(taken && c == Sim::edges(t0, late) && Sim::tcaIsrs == 1, "pending overflow counted once");
+}
+//-----------------------------------------------
+static void thermistor()
+{
+    printf("thermistor through the gate, 612.37 counts, 1.5 counts rms noise\n");
+    start(F_CPU, 9700, 0);
+    Sim::therm = 612.37;
+    Sim::thermNoise = 1.5;
+    ADC0.CTRLA = ADC_ENABLE_bm;     // the application's own setup
+    ADC0.CTRLC = 0x13;
+    ADC0.MUXPOS = 0x01;
+    H::setThermistor(ADC_MUXPOS_AIN5_gc);
+
+    double t0 = Sim::now;
+    H::beginCounting(done);
+    uint16_t adc, c = 0;
+    Sim::run(0.5);
+    check(!H::takeThermistor(adc), "nothing until the sample is in");
+    bool taken;
+    overlap(c, taken);
+    double dt = Sim::now - t0;
+    uint16_t n = H::thermistorSamples();
+    bool got = H::takeThermistor(adc, 4);
+    printf("    %u counts and %u conversions in %.3fs, mean %.3f\n", c, n, dt, adc / 16.0);
+    check(taken && c == Sim::edges(t0, t0 + 1) && dt < 1.01, "counts and thermistor in the one 1s wake");
+    check(n >= 510 && n <= 512 && Sim::adcIsrs == n, "a conversion per PIT event");
+    check(got && fabs(adc - 612.37 * 16) <= 4, "oversampled to 1/16 count");
+    check(ADC0.CTRLA == ADC_ENABLE_bm && ADC0.CTRLC == 0x13 && ADC0.MUXPOS == 0x01
+        && ADC0.EVCTRL == 0 && ADC0.INTCTRL == 0, "ADC0 given back");
+
+    H::calibrateClock();
+    check(Sim::adcIsrs == n && ADC0.MUXPOS == 0x01, "calibrateClock() converts nothing");
+
+    H::beginCounting();
+    Sim::run(0.5);
+    unsigned part = Sim::adcIsrs;
+    H::setThermistor(H::noThermistor);
+    check(part > n + 200u && ADC0.MUXPOS == 0x01 && ADC0.INTCTRL == 0, "noThermistor mid sample gives ADC0 back");
+    check(RTC.PITCTRLA == 0 && EVSYS.ASYNCCH3 == 0 && EVSYS.ASYNCUSER1 == 0, "PIT and its event channel off");
+    H::endCounting();
+    check(!H::takeThermistor(adc) && Sim::adcIsrs == part, "no conversions after, none taken");
+    H::beginCounting();
+    H::endCounting();
+    check(!H::takeThermistor(adc) && Sim::adcIsrs == part, "off again with noThermistor");
+}
+//-----------------------------------------------
+int main()
+{
+    blockingGate();
+    callbackGate();
+    callbackReciprocal();
+    stopped();
+    backToBack();
+    calibration();
+    continuous();
+    wideGate();
+    pendingOverflow();
+    thermistor();
+    printf("%d failed\n", failures);
+    return failures;
+}
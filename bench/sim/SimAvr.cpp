@@ -0,0 +1,342 @@
+/** @file
+    Host simulation of the ATtiny3216 timers, see SimAvr.h.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SimAvr.h"
+#include "clocks.h"
+#include "tca.h"
+
+SimTcaRegs TCA0;
+SimRtcRegs RTC;
+SimTcbRegs TCB0;
+SimEvsysRegs EVSYS;
+SimAdcRegs ADC0;
+
+namespace Sim
+{
+    double now, clkHz, oscHz, oscPhase, therm, thermNoise;
+    bool interrupts;
+    unsigned rtcIsrs, tcaIsrs, tcbIsrs, adcIsrs, sleeps;
+}
+
+using namespace Sim;
+
+static const double NEVER = 1e30;
+
+static bool rtcOn, rtcPending;
+static uint16_t rtcPeriod;
+static double rtcNext;
+
+static bool tcaOn, tcaEvents;
+static double tcaStart;
+static uint16_t tcaBase;
+static uint32_t tcaWraps;       ///< overflows since tcaStart
+
+static bool tcbOn, tcbPending;
+static int64_t tcbLast;         ///< CLK_PER tick of the last capture, or the enable
+
+static double pitPeriod;        ///< of the PIT event on ASYNCCH3, 0 for none
+static double pitNext;
+
+static bool adcBusy;
+static double adcDone;
+static uint32_t noiseState;
+
+//-----------------------------------------------
+// vectors humid.cpp leaves out unless opted in; never called then
+__attribute__((weak)) void TCB0_INT_vect() {}
+__attribute__((weak)) void TCA0_OVF_vect() { TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm; }
+__attribute__((weak)) void ADC0_RESRDY_vect() {}
+
+//-----------------------------------------------
+static int64_t tick(double t)
+{
+    return int64_t(floor(t * clkHz));
+}
+//-----------------------------------------------
+/// First oscillator edge after t
+static double nextEdge(double t)
+{
+    double k = floor((t - oscPhase) * oscHz + 1e-9) + 1;
+    return oscPhase + k / oscHz;
+}
+//-----------------------------------------------
+/// Time of TCA0's next overflow: the edge that takes it through 0x10000
+static double nextWrap()
+{
+    if (!tcaOn || !tcaEvents || oscHz <= 0)
+        return NEVER;
+    double k = floor((tcaStart - oscPhase) * oscHz)
+        + (0x10000 - tcaBase) + 0x10000 * double(tcaWraps);
+    return oscPhase + k / oscHz;
+}
+//-----------------------------------------------
+/// TCB0 is switched by plain register writes; pick them up
+static void syncTcb()
+{
+    bool on = TCB0.CTRLA & TCB_ENABLE_bm;
+    if (on && !tcbOn)
+        tcbLast = tick(now);
+    tcbOn = on;
+}
+//-----------------------------------------------
+/// PIT events on ASYNCCH3 (PIT_DIV8192..PIT_DIV64), if it's enabled
+static void syncPit()
+{
+    uint8_t ch = EVSYS.ASYNCCH3;
+    double p = (RTC.PITCTRLA & RTC_PITEN_bm) && ch >= 0x0A && ch <= 0x11
+        ? (8192 >> (ch - 0x0A)) / 32768.0
+        : 0;
+    if (p != pitPeriod)
+        pitNext = p ? (floor(now / p) + 1) * p : NEVER;
+    pitPeriod = p;
+}
+//-----------------------------------------------
+/// A conversion is lost if ADC0 is disabled under it
+static void syncAdc()
+{
+    if (!(ADC0.CTRLA & ADC_ENABLE_bm))
+        adcBusy = false;
+}
+//-----------------------------------------------
+/// Standard normal, from a fixed seed so runs repeat
+static double gauss()
+{
+    double u[2];
+    for (double& v : u)
+    {
+        noiseState = noiseState * 1664525u + 1013904223u;
+        v = ((noiseState >> 8) + 0.5) / 16777216.0;
+    }
+    return sqrt(-2 * log(u[0])) * cos(2 * M_PI * u[1]);
+}
+//-----------------------------------------------
+/// The thermistor as a 10 bit conversion
+static uint16_t convert()
+{
+    double v = floor(therm + thermNoise * gauss() + 0.5);
+    return uint16_t(v < 0 ? 0 : v > 1023 ? 1023 : v);
+}
+//-----------------------------------------------
+/// Run the ISRs that are due, as the AVR would: one at a time, I clear,
+/// lowest vector first
+static void dispatch()
+{
+    while (interrupts)
+    {
+        syncTcb();
+        if (rtcPending && (RTC.INTCTRL & RTC_OVF_bm))
+        {
+            rtcPending = false;
+            ++rtcIsrs;
+            interrupts = false;
+            RTC_CNT_vect();
+            interrupts = true;
+        }
+        else if ((TCA0.SINGLE.INTFLAGS & TCA_SINGLE_OVF_bm) && (TCA0.SINGLE.INTCTRL & TCA_SINGLE_OVF_bm))
+        {
+            ++tcaIsrs;
+            interrupts = false;
+            TCA0_OVF_vect();
+            interrupts = true;
+        }
+        else if (tcbPending && tcbOn && (TCB0.INTCTRL & TCB_CAPT_bm))
+        {
+            tcbPending = false;
+            ++tcbIsrs;
+            interrupts = false;
+            TCB0_INT_vect();
+            interrupts = true;
+        }
+        else if ((ADC0.INTFLAGS & ADC_RESRDY_bm) && (ADC0.INTCTRL & ADC_RESRDY_bm))
+        {
+            ADC0.INTFLAGS = ADC_RESRDY_bm;      // as the ISR reading RES does
+            ++adcIsrs;
+            interrupts = false;
+            ADC0_RESRDY_vect();
+            interrupts = true;
+        }
+        else
+            break;
+    }
+}
+//-----------------------------------------------
+/**
+    Advance to the next event, if it's no later than until.
+    @return true if one happened
+ */
+static bool step(double until)
+{
+    syncTcb();
+    syncPit();
+    syncAdc();
+    double tr = rtcOn ? rtcNext : NEVER;
+    double tw = nextWrap();
+    double te = tcbOn && oscHz > 0 ? nextEdge(now) : NEVER;
+    double tp = pitNext;
+    double ta = adcBusy ? adcDone : NEVER;
+    double t = tr < te ? tr : te;
+    t = tw < t ? tw : t;
+    t = tp < t ? tp : t;
+    t = ta < t ? ta : t;
+    if (t > until || t >= NEVER)
+    {
+        now = until < NEVER ? until : now;
+        return false;
+    }
+
+    now = t;
+    if (tr == t)
+    {
+        RTC.INTFLAGS |= RTC_OVF_bm;
+        rtcNext += (rtcPeriod + 1) / 8.0;
+        rtcPending = true;
+    }
+    else if (tw == t)
+    {
+        TCA0.SINGLE.INTFLAGS.bits |= TCA_SINGLE_OVF_bm;
+        ++tcaWraps;
+    }
+    else if (tp == t)
+    {
+        pitNext += pitPeriod;
+        // ASYNCUSER1 (ADC0) on ASYNCCH3 starts a conversion, unless one's running
+        if ((ADC0.CTRLA & ADC_ENABLE_bm) && (ADC0.EVCTRL & ADC_STARTEI_bm)
+            && EVSYS.ASYNCUSER1 == 0x6 && !adcBusy)
+        {
+            adcBusy = true;
+            adcDone = now + 15.0 * (2 << (ADC0.CTRLC & 0x07)) / clkHz;
+        }
+    }
+    else if (ta == t)
+    {
+        adcBusy = false;
+        ADC0.RES = convert();
+        ADC0.INTFLAGS.bits |= ADC_RESRDY_bm;
+    }
+    else
+    {
+        // frequency measurement: capture and restart on the edge
+        int64_t c = tick(now);
+        TCB0.CCMP = uint16_t(c - tcbLast);
+        tcbLast = c;
+        TCB0.INTFLAGS |= TCB_CAPT_bm;
+        tcbPending = true;
+    }
+    dispatch();
+    return true;
+}
+//-----------------------------------------------
+void Sim::reset(double clk, double osc)
+{
+    now = 0;
+    clkHz = clk;
+    oscHz = osc;
+    oscPhase = 0;
+    therm = 0;
+    thermNoise = 0;
+    interrupts = true;
+    rtcIsrs = tcaIsrs = tcbIsrs = adcIsrs = sleeps = 0;
+
+    TCA0 = SimTcaRegs();
+    RTC = SimRtcRegs();
+    TCB0 = SimTcbRegs();
+    EVSYS = SimEvsysRegs();
+    ADC0 = SimAdcRegs();
+    rtcOn = rtcPending = false;
+    rtcPeriod = 0;
+    tcaOn = tcaEvents = false;
+    tcaBase = 0;
+    tcaWraps = 0;
+    tcbOn = tcbPending = false;
+    pitPeriod = 0;
+    pitNext = NEVER;
+    adcBusy = false;
+    noiseState = 1;
+}
+//-----------------------------------------------
+void Sim::run(double dt)
+{
+    double until = now + dt;
+    while (step(until))
+        ;
+}
+//-----------------------------------------------
+void Sim::sleepCpu()
+{
+    ++sleeps;
+    if (!step(NEVER))
+    {
+        fprintf(stderr, "sleep_cpu() with nothing to wake it at %.6fs\n", now);
+        exit(2);
+    }
+}
+//-----------------------------------------------
+void Sim::enableInterrupts()
+{
+    interrupts = true;
+    dispatch();
+}
+//-----------------------------------------------
+uint32_t Sim::edges(double t0, double t1)
+{
+    if (oscHz <= 0)
+        return 0;
+    return uint32_t(floor((t1 - oscPhase) * oscHz) - floor((t0 - oscPhase) * oscHz));
+}
+//-----------------------------------------------
+void RtcControl::enableOvfInterrupt(bool on)
+{
+    RTC.INTCTRL = on ? RTC.INTCTRL | RTC_OVF_bm : RTC.INTCTRL & ~RTC_OVF_bm;
+}
+//-----------------------------------------------
+void RtcControl::enable(bool on)
+{
+    if (on && !rtcOn)
+        rtcNext = now + (rtcPeriod + 1) / 8.0;
+    rtcOn = on;
+}
+//-----------------------------------------------
+void RtcControl::period(uint16_t p)
+{
+    rtcPeriod = p;
+}
+//-----------------------------------------------
+void TCA0Control::eventCountEnable(bool on)
+{
+    tcaEvents = on;
+}
+//-----------------------------------------------
+void TCA0Control::enable(bool on)
+{
+    if (on == tcaOn)
+        return;
+    if (on)
+    {
+        tcaStart = now;
+        tcaWraps = 0;
+    }
+    else
+        tcaBase = count();
+    tcaOn = on;
+}
+//-----------------------------------------------
+uint16_t TCA0Control::count()
+{
+    if (!tcaOn)
+        return tcaBase;
+    uint32_t n = tcaEvents
+        ? edges(tcaStart, now)
+        : uint32_t(tick(now) / 1024 - tick(tcaStart) / 1024);
+    return uint16_t(tcaBase + n);
+}
+//-----------------------------------------------
+void TCA0Control::count(uint16_t c)
+{
+    tcaBase = c;
+    tcaStart = now;
+    tcaWraps = 0;
+}
@@ -0,0 +1,99 @@
+/** @file
+    Host simulation of the ATtiny3216 parts humid.cpp drives: the RTC
+    overflow, TCA0 event / clock counting and its overflow in event
+    counting, TCB0 frequency measurement, ADC0 conversions of a noisy
+    thermistor started by PIT events, the humidity oscillator on the
+    event channel, interrupts and idle sleep. The headers in this directory stand in for the AVR and
+    megaTinyCore ones, so the real humid.cpp builds and runs on Linux
+    (bench/SimHumid.cpp).
+
+    Time only moves in Sim::run() (the main loop busy for a while) and
+    sleep_cpu() (to the next interrupt); ISRs fire at their event times
+    while interrupts are enabled, or at sei() if they came in while not.
+ */
+#ifndef SIM_AVR_H
+#define SIM_AVR_H
+
+#include <stdint.h>
+
+#ifndef F_CPU
+#define F_CPU 20000000UL
+#endif
+
+//-----------------------------------------------
+/// Interrupt flags that clear by writing 1, as TCA0's and ADC0's do
+struct SimW1c
+{
+    volatile uint8_t bits;
+
+    SimW1c& operator=(uint8_t m) { bits &= ~m; return *this; }
+    operator uint8_t() const { return bits; }
+};
+
+//-----------------------------------------------
+// registers humid.cpp touches directly
+struct SimTcaSingle { volatile uint8_t INTCTRL; SimW1c INTFLAGS; };
+struct SimTcaRegs   { SimTcaSingle SINGLE; };
+struct SimRtcRegs   { volatile uint8_t INTCTRL, INTFLAGS, PITCTRLA, PITSTATUS, PITINTCTRL; };
+struct SimTcbRegs   { volatile uint8_t CTRLA, CTRLB, EVCTRL, INTCTRL, INTFLAGS; volatile uint16_t CNT, CCMP; };
+struct SimEvsysRegs { volatile uint8_t SYNCCH0, SYNCUSER0, ASYNCCH3, ASYNCUSER0, ASYNCUSER1; };
+struct SimAdcRegs   { volatile uint8_t CTRLA, CTRLC, MUXPOS, EVCTRL, INTCTRL; SimW1c INTFLAGS; volatile uint16_t RES; };
+
+extern SimTcaRegs TCA0;
+extern SimRtcRegs RTC;
+extern SimTcbRegs TCB0;
+extern SimEvsysRegs EVSYS;
+extern SimAdcRegs ADC0;
+
+#define RTC_OVF_bm              0x01
+#define RTC_CMP_bm              0x02
+#define RTC_PITEN_bm            0x01
+#define RTC_CTRLBUSY_bm         0x01
+#define RTC_PERIOD_CYC32768_gc  (0x0E << 3)
+#define TCA_SINGLE_OVF_bm       0x01
+#define TCB_ENABLE_bm           0x01
+#define TCB_CLKSEL_CLKDIV1_gc   0x00
+#define TCB_CNTMODE_FRQ_gc      0x03
+#define TCB_CAPTEI_bm           0x01
+#define TCB_CAPT_bm             0x01
+#define ADC_ENABLE_bm           0x01
+#define ADC_RESSEL_10BIT_gc     0x00
+#define ADC_PRESC_DIV16_gc      0x03
+#define ADC_REFSEL_VDDREF_gc    0x10
+#define ADC_SAMPCAP_bm          0x40
+#define ADC_STARTEI_bm          0x01
+#define ADC_RESRDY_bm           0x01
+#define ADC_MUXPOS_AIN5_gc      0x05
+
+#define ISR(vector) void vector()
+void RTC_CNT_vect();
+void TCA0_OVF_vect();
+void TCB0_INT_vect();
+void ADC0_RESRDY_vect();
+
+//-----------------------------------------------
+namespace Sim
+{
+    extern double now;          ///< seconds since reset
+    extern double clkHz;        ///< actual CLK_PER; F_CPU is what the code believes
+    extern double oscHz;        ///< humidity oscillator, 0 when stopped
+    extern double oscPhase;     ///< time of an oscillator edge, s
+    extern double therm;        ///< thermistor voltage, in ADC counts
+    extern double thermNoise;   ///< rms noise on it, counts
+
+    extern bool interrupts;     ///< as the I flag
+    extern unsigned rtcIsrs, tcaIsrs, tcbIsrs, adcIsrs, sleeps;
+
+    /// Back to reset, clock and oscillator as given, no thermistor noise
+    void reset(double clkHz, double oscHz);
+    /// The main loop busy for dt seconds; interrupts fire on time
+    void run(double dt);
+    /// sleep_cpu(): to the next interrupt
+    void sleepCpu();
+    /// sei(): and run what came in meanwhile
+    void enableInterrupts();
+    /// Oscillator edges in (t0, t1]
+    uint32_t edges(double t0, double t1);
+}
+
+#endif
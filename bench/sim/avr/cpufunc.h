@@ -0,0 +1 @@
+#include "SimAvr.h"
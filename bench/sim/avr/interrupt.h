@@ -0,0 +1,4 @@
+#include "SimAvr.h"
+
+inline void cli() { Sim::interrupts = false; }
+inline void sei() { Sim::enableInterrupts(); }
@@ -0,0 +1,31 @@
+/** @file
+    Simulated ClockControl / RtcControl, as humid.cpp uses them.
+ */
+#ifndef SIM_CLOCKS_H
+#define SIM_CLOCKS_H
+
+#include "SimAvr.h"
+
+struct ClockControl
+{
+    static void waitForXtal() {}
+    static void enableXtal(bool, bool) {}
+    static void disableXtal() {}
+};
+
+struct RtcControl
+{
+    enum class Prescale { DIV4K };
+
+    static void prescale(Prescale) {}
+    static void enableOvfInterrupt(bool on);
+    static void runInSleep(bool) {}
+    static void clockXT32k() {}
+    static void enable(bool on);
+    static void clearInterruptFlags() { RTC.INTFLAGS = 0; }
+    static void clearPrescaler() {}
+    /// Overflow every p + 1 ticks of 8Hz
+    static void period(uint16_t p);
+};
+
+#endif
@@ -0,0 +1,24 @@
+/** @file
+    Simulated TCA0Control, as humid.cpp uses it: counts oscillator
+    edges, or CLK_PER / 1024 with event counting off.
+ */
+#ifndef SIM_TCA_H
+#define SIM_TCA_H
+
+#include "SimAvr.h"
+
+enum class TcaClock { Div1028 };
+enum class EventAction { PosEdge };
+
+struct TCA0Control
+{
+    static void reset(bool) {}
+    static void clockSelect(TcaClock) {}
+    static void eventAction(EventAction) {}
+    static void eventCountEnable(bool on);
+    static void enable(bool on);
+    static uint16_t count();
+    static void count(uint16_t c);
+};
+
+#endif
@@ -0,0 +1,350 @@
+/*
+* CalImage.cpp
+*
+* Binary calibration image; see CalImage.h for the layout.
+*/
+
+#include "CalImage.h"
+#include <string.h>
+
+#ifndef ARDUINO
+#include <algorithm>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// CRC-32 (IEEE, as zlib) a nibble at a time; 64 bytes of table
+static const uint32_t CRC_NIBBLE[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+#ifndef ARDUINO
+//----------------------------------------------------
+/// Byte at a time table, built from the nibble one on first use
+struct CrcBytes
+{
+    uint32_t t[256];
+    CrcBytes()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t c = i;
+            c = (c >> 4) ^ CRC_NIBBLE[c & 15];
+            t[i] = (c >> 4) ^ CRC_NIBBLE[c & 15];
+        }
+    }
+};
+#endif
+//----------------------------------------------------
+static inline uint32_t align8(uint32_t n)
+{
+    return (n + 7) & ~uint32_t(7);
+}
+//----------------------------------------------------
+uint32_t CalImage::crc32(const void* data, size_t n, uint32_t crc)
+{
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+#ifndef ARDUINO
+    static const CrcBytes bytes;
+    while (n--)
+        crc = (crc >> 8) ^ bytes.t[(crc ^ *p++) & 255];
+#else
+    while (n--)
+    {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ CRC_NIBBLE[crc & 15];
+        crc = (crc >> 4) ^ CRC_NIBBLE[crc & 15];
+    }
+#endif
+    return ~crc;
+}
+//----------------------------------------------------
+CalImage::Status CalImage::open(const void* image, size_t size)
+{
+    _base = nullptr;
+    _size = 0;
+    _dir = nullptr;
+    _count = 0;
+
+    const CalHeader* h = static_cast<const CalHeader*>(image);
+    if (!image || size < sizeof(CalHeader))
+        return Status::TooSmall;
+    if (reinterpret_cast<uintptr_t>(image) & 7)
+        return Status::BadLayout;
+    if (h->magic != CAL_MAGIC)
+        return Status::BadMagic;
+    if (h->version == 0 || h->version > CAL_VERSION)
+        return Status::BadVersion;
+    if (h->fileSize > size)
+        return Status::TooSmall;
+
+    _base = static_cast<const uint8_t*>(image);
+    _size = h->fileSize;
+
+    uint32_t dirBytes = h->profileCount * uint32_t(sizeof(CalDirEntry));
+    if (h->headerSize < sizeof(CalHeader) || (h->headerSize & 7)
+        || h->profileCount > _size / sizeof(CalDirEntry) || !fits(h->headerSize, dirBytes))
+    {
+        _base = nullptr;
+        _size = 0;
+        return Status::BadLayout;
+    }
+
+    const CalDirEntry* dir = reinterpret_cast<const CalDirEntry*>(_base + h->headerSize);
+    if (crc32(dir, dirBytes) != h->dirCrc)
+    {
+        _base = nullptr;
+        _size = 0;
+        return Status::BadCrc;
+    }
+
+    // find() needs them sorted
+    for (uint32_t i = 1; i < h->profileCount; ++i)
+    {
+        if (dir[i].sensorId <= dir[i - 1].sensorId)
+        {
+            _base = nullptr;
+            _size = 0;
+            return Status::BadLayout;
+        }
+    }
+
+    _dir = dir;
+    _count = h->profileCount;
+    return Status::Ok;
+}
+//----------------------------------------------------
+const CalProfile* CalImage::profile(uint32_t i, bool check) const
+{
+    if (i >= _count)
+        return nullptr;
+
+    const CalDirEntry& e = _dir[i];
+    if ((e.offset & 7) || e.size < sizeof(CalProfile) || !fits(e.offset, e.size))
+        return nullptr;
+
+    const CalProfile* p = reinterpret_cast<const CalProfile*>(_base + e.offset);
+    if (p->sensorId != e.sensorId || p->tableSize < sizeof(CalTable)
+        || uint32_t(p->tableCount) * p->tableSize > e.size - sizeof(CalProfile))
+        return nullptr;
+
+    const uint8_t* tables = reinterpret_cast<const uint8_t*>(p + 1);
+    for (uint16_t n = 0; n < p->tableCount; ++n)
+    {
+        const CalTable* t = reinterpret_cast<const CalTable*>(tables + n * p->tableSize);
+        uint32_t bytes = uint32_t(t->rows) * t->cols * sizeof(int16_t);
+        if ((t->dims != 1 && t->dims != 2) || (t->dims == 1 && t->cols != 1)
+            || (t->data & 1) || t->data > e.size || bytes > e.size - t->data)
+            return nullptr;
+    }
+
+    if (check && crc32(p, e.size) != e.crc)
+        return nullptr;
+
+    return p;
+}
+//----------------------------------------------------
+const CalProfile* CalImage::find(uint32_t sensorId, bool check) const
+{
+    uint32_t lo = 0, hi = _count;
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (_dir[mid].sensorId < sensorId)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < _count && _dir[lo].sensorId == sensorId ? profile(lo, check) : nullptr;
+}
+//----------------------------------------------------
+CalImage::Status CalImage::verify() const
+{
+    for (uint32_t i = 0; i < _count; ++i)
+    {
+        if (!profile(i, false))
+            return Status::BadLayout;
+        if (!profile(i, true))
+            return Status::BadCrc;
+    }
+    return Status::Ok;
+}
+//----------------------------------------------------
+const CalTable* CalImage::table(const CalProfile& p, CalRole role)
+{
+    const uint8_t* tables = reinterpret_cast<const uint8_t*>(&p + 1);
+    for (uint16_t n = 0; n < p.tableCount; ++n)
+    {
+        const CalTable* t = reinterpret_cast<const CalTable*>(tables + n * p.tableSize);
+        if (t->role == role)
+            return t;
+    }
+    return nullptr;
+}
+
+#ifndef ARDUINO
+//----------------------------------------------------
+CalImage::Status CalImageFile::open(const char* path)
+{
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return Status::TooSmall;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < off_t(sizeof(CalHeader)))
+    {
+        ::close(fd);
+        return Status::TooSmall;
+    }
+
+    void* map = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        return Status::TooSmall;
+
+    _map = map;
+    _mapSize = size_t(st.st_size);
+
+    Status s = CalImage::open(_map, _mapSize);
+    if (s != Status::Ok)
+        close();
+    return s;
+}
+//----------------------------------------------------
+void CalImageFile::close()
+{
+    if (_map)
+        munmap(_map, _mapSize);
+    _map = nullptr;
+    _mapSize = 0;
+    _base = nullptr;
+    _size = 0;
+    _dir = nullptr;
+    _count = 0;
+}
+//----------------------------------------------------
+void CalImageWriter::addProfile(uint32_t sensorId)
+{
+    auto i = _index.find(sensorId);
+    if (i == _index.end())
+    {
+        _index[sensorId] = _profiles.size();
+        _profiles.push_back(Profile{ sensorId, {}, {} });
+        _currentAt = _profiles.size() - 1;
+        return;
+    }
+
+    Profile& p = _profiles[i->second];
+    p.tables.clear();
+    p.values.clear();
+    _currentAt = i->second;
+}
+//----------------------------------------------------
+CalImageWriter::Profile* CalImageWriter::current()
+{
+    return _currentAt < _profiles.size() ? &_profiles[_currentAt] : nullptr;
+}
+//----------------------------------------------------
+bool CalImageWriter::addTable(CalRole role, uint16_t scale, const CalAxis& axis, uint16_t n, const int16_t* values)
+{
+    if (!addTable(role, scale, axis, n, CalAxis{ 0, 0, 0 }, 1, values))
+        return false;
+    current()->tables.back().dims = 1;
+    return true;
+}
+//----------------------------------------------------
+bool CalImageWriter::addTable(CalRole role, uint16_t scale, const CalAxis& rows, uint16_t nRows,
+                              const CalAxis& cols, uint16_t nCols, const int16_t* values)
+{
+    Profile* p = current();
+    if (!p)
+        return false;
+
+    CalTable t;
+    memset(&t, 0, sizeof(t));
+    t.dims = 2;
+    t.role = role;
+    t.scale = scale;
+    t.rows = nRows;
+    t.cols = nCols;
+    t.axis[0] = rows;
+    t.axis[1] = cols;
+
+    p->tables.push_back(t);
+    p->values.push_back(std::vector<int16_t>(values, values + size_t(nRows) * nCols));
+    return true;
+}
+//----------------------------------------------------
+std::vector<uint8_t> CalImageWriter::build() const
+{
+    std::vector<const Profile*> order;
+    for (const Profile& p : _profiles)
+        order.push_back(&p);
+    std::stable_sort(order.begin(), order.end(),
+        [](const Profile* a, const Profile* b) { return a->sensorId < b->sensorId; });
+
+    uint32_t count = uint32_t(order.size());
+    uint32_t offset = align8(sizeof(CalHeader) + count * sizeof(CalDirEntry));
+
+    std::vector<CalDirEntry> dir(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const Profile& p = *order[i];
+        uint32_t size = align8(sizeof(CalProfile) + p.tables.size() * sizeof(CalTable));
+        for (const auto& v : p.values)
+            size = align8(size + v.size() * sizeof(int16_t));
+        dir[i] = CalDirEntry{ p.sensorId, offset, size, 0 };
+        offset += size;
+    }
+
+    std::vector<uint8_t> out(offset, 0);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const Profile& p = *order[i];
+        uint8_t* base = out.data() + dir[i].offset;
+
+        CalProfile ph = { p.sensorId, uint16_t(p.tables.size()), uint16_t(sizeof(CalTable)) };
+        memcpy(base, &ph, sizeof(ph));
+
+        uint32_t data = align8(sizeof(CalProfile) + p.tables.size() * sizeof(CalTable));
+        for (size_t n = 0; n < p.tables.size(); ++n)
+        {
+            CalTable t = p.tables[n];
+            t.data = data;
+            memcpy(base + sizeof(CalProfile) + n * sizeof(CalTable), &t, sizeof(t));
+            memcpy(base + data, p.values[n].data(), p.values[n].size() * sizeof(int16_t));
+            data = align8(data + p.values[n].size() * sizeof(int16_t));
+        }
+        dir[i].crc = CalImage::crc32(base, dir[i].size);
+    }
+
+    CalHeader h;
+    memset(&h, 0, sizeof(h));
+    h.magic = CAL_MAGIC;
+    h.version = CAL_VERSION;
+    h.headerSize = sizeof(CalHeader);
+    h.profileCount = count;
+    h.fileSize = offset;
+    h.dirCrc = CalImage::crc32(dir.data(), count * sizeof(CalDirEntry));
+    memcpy(out.data(), &h, sizeof(h));
+    memcpy(out.data() + sizeof(CalHeader), dir.data(), count * sizeof(CalDirEntry));
+    return out;
+}
+//----------------------------------------------------
+bool CalImageWriter::save(const char* path) const
+{
+    std::vector<uint8_t> image = build();
+    FILE* f = fopen(path, "wb");
+    if (!f)
+        return false;
+    bool ok = fwrite(image.data(), 1, image.size(), f) == image.size();
+    return fclose(f) == 0 && ok;
+}
+#endif
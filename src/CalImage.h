@@ -0,0 +1,214 @@
+/** @file
+    Binary calibration image: per sensor tables and their metadata in
+    one file, laid out so a mapped file is used in place.
+
+    Native (little endian) byte order, every section 8 byte aligned:
+
+        CalHeader
+        CalDirEntry[profileCount]       sorted by sensorId
+        per profile: CalProfile, CalTable[tableCount], int16_t values
+
+    The header's crc covers the directory and each directory entry the
+    profile it points at. open() checks only the header and directory,
+    so opening thousands of profiles touches a few bytes each; a
+    profile's crc is checked when it is asked for, or all at once with
+    verify().
+
+    Nothing is copied: CalImage::values() points into the image, and
+    InterpolatedLookup1D or HS1101Mapped use that pointer directly.
+
+    For the gateway, not the sensor: the mapping and writing halves are
+    not built for ARDUINO.
+ */
+#ifndef CAL_IMAGE_H
+#define CAL_IMAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#ifndef ARDUINO
+#include <map>
+#include <vector>
+#endif
+
+static const uint32_t CAL_MAGIC = 0x43495350;  ///< "PSIC"
+static const uint16_t CAL_VERSION = 1;
+
+//-----------------------------------------------
+/// What a table converts
+enum class CalRole : uint8_t
+{
+    Thermistor = 1,     ///< ADC counts to temperature
+    Humidity = 2        ///< temperature rows, oscillator count columns, to RH%
+};
+//-----------------------------------------------
+struct CalHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;    ///< later versions may add fields; the directory follows
+    uint32_t profileCount;
+    uint32_t fileSize;
+    uint32_t dirCrc;        ///< CRC-32 of the directory
+    uint32_t reserved[3];
+};
+//-----------------------------------------------
+struct CalDirEntry
+{
+    uint32_t sensorId;
+    uint32_t offset;        ///< of the CalProfile, from the start of the image
+    uint32_t size;          ///< profile bytes, tables and values included
+    uint32_t crc;           ///< CRC-32 of those bytes
+};
+//-----------------------------------------------
+struct CalProfile
+{
+    uint32_t sensorId;
+    uint16_t tableCount;
+    uint16_t tableSize;     ///< sizeof(CalTable) as written
+};
+//-----------------------------------------------
+/// Input side of one table dimension
+struct CalAxis
+{
+    int32_t lo;             ///< input at the first entry
+    int32_t hi;             ///< inputs at or past this clamp
+    int32_t step;           ///< input distance between entries
+};
+//-----------------------------------------------
+/**
+    One table of rows x cols int16_t values; 1D tables have one column
+    and only axis[0].
+ */
+struct CalTable
+{
+    uint8_t  dims;
+    CalRole  role;
+    uint16_t scale;         ///< values are the real value times this
+    uint16_t rows;
+    uint16_t cols;
+    CalAxis  axis[2];       ///< rows, then columns
+    uint32_t data;          ///< offset of the values, from the CalProfile
+    uint32_t reserved;
+};
+
+static_assert(sizeof(CalHeader) == 32, "CalHeader layout");
+static_assert(sizeof(CalDirEntry) == 16, "CalDirEntry layout");
+static_assert(sizeof(CalProfile) == 8, "CalProfile layout");
+static_assert(sizeof(CalTable) == 40, "CalTable layout");
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    View over an image held by someone else.
+ */
+class CalImage
+{
+public:
+    enum class Status
+    {
+        Ok,
+        TooSmall, BadMagic, BadVersion, BadLayout, BadCrc
+    };
+
+protected:
+    const uint8_t* _base;
+    size_t _size;
+    const CalDirEntry* _dir;
+    uint32_t _count;
+
+    bool fits(uint32_t offset, uint32_t size) const { return offset <= _size && size <= _size - offset; }
+
+public:
+    CalImage() : _base(nullptr), _size(0), _dir(nullptr), _count(0) {}
+
+    /// Check the header and directory; profiles are checked as they are used
+    Status open(const void* image, size_t size);
+
+    /// Profiles in the image
+    uint32_t count() const { return _count; }
+
+    const CalDirEntry& entry(uint32_t i) const { return _dir[i]; }
+
+    /**
+        Profile i.
+        @param check    Check its crc as well as its layout
+        @return         null if i is out of range or the profile is bad
+     */
+    const CalProfile* profile(uint32_t i, bool check = true) const;
+
+    /// profile() by sensor id; the directory is sorted, so a binary search
+    const CalProfile* find(uint32_t sensorId, bool check = true) const;
+
+    /// Check every profile's crc
+    Status verify() const;
+
+    /// First table for a role, or null
+    static const CalTable* table(const CalProfile& p, CalRole role);
+
+    /// A table's values, in place
+    static const int16_t* values(const CalProfile& p, const CalTable& t)
+    {
+        return reinterpret_cast<const int16_t*>(reinterpret_cast<const uint8_t*>(&p) + t.data);
+    }
+
+    static uint32_t crc32(const void* data, size_t n, uint32_t crc = 0);
+};
+
+#ifndef ARDUINO
+//-----------------------------------------------
+//-----------------------------------------------
+/// CalImage over a read only mapping of a file
+class CalImageFile : public CalImage
+{
+    void* _map;
+    size_t _mapSize;
+
+    CalImageFile(const CalImageFile&) = delete;
+    CalImageFile& operator=(const CalImageFile&) = delete;
+
+public:
+    CalImageFile() : _map(nullptr), _mapSize(0) {}
+    ~CalImageFile() { close(); }
+
+    /// Map and open(); TooSmall if the file can't be mapped
+    Status open(const char* path);
+    void close();
+};
+//-----------------------------------------------
+//-----------------------------------------------
+/// Builds an image; profiles are sorted by sensor id on build()
+class CalImageWriter
+{
+    struct Profile
+    {
+        uint32_t sensorId;
+        std::vector<CalTable> tables;
+        std::vector<std::vector<int16_t>> values;
+    };
+    std::vector<Profile> _profiles;
+    std::map<uint32_t, size_t> _index;      ///< sensor id to _profiles entry
+    size_t _currentAt = size_t(-1);         ///< profile tables go to, none yet
+    Profile* current();
+
+public:
+    /**
+        Start a profile; tables added go to it. An id already added is
+        started again, its tables dropped, so a re-provisioned sensor
+        replaces its old profile (open() refuses duplicate ids).
+     */
+    void addProfile(uint32_t sensorId);
+
+    /// Add a 1D table of n values; false if no profile was started
+    bool addTable(CalRole role, uint16_t scale, const CalAxis& axis, uint16_t n, const int16_t* values);
+
+    /// Add a 2D table, row major; false if no profile was started
+    bool addTable(CalRole role, uint16_t scale, const CalAxis& rows, uint16_t nRows,
+                  const CalAxis& cols, uint16_t nCols, const int16_t* values);
+
+    std::vector<uint8_t> build() const;
+
+    bool save(const char* path) const;
+};
+#endif
+
+#endif
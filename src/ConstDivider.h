@@ -0,0 +1,179 @@
+/** @file
+    Division by a compile time constant as a multiply and shift.
+
+    GCC already does this for host builds, but avr-gcc at -Os calls
+    __udivmodhi4/__divmodsi4 instead, which costs hundreds of cycles a
+    go. The multiplier is chosen here so the result is exact for every
+    dividend up to MAXN; verify() checks that exhaustively.
+
+    The product n * multiplier is formed the cheapest way that holds it:
+    - narrow: under 2^32, one 32 bit multiply;
+    - split: under 2^48, from four 16x16->32 products (__umulhisi3 on
+      AVR, ~20 cycles each with MUL), see mulShiftSplit();
+    - long: a 32 bit multiplier, but over 2^48, e.g. /1270 of a 16 bit
+      difference times a residue; the same four products, with the
+      carries into a top word kept, see mulShiftLong();
+    - wide: a 64 bit multiply (__muldi3 on AVR); only a multiplier past
+      32 bits, i.e. dividends near 2^31, gets here.
+    Which one a divider takes depends on D as much as MAXN: for D = 31,
+    the interpolation divisor of 5 residue bit tables, the shift is
+    large enough that even MAXN = 65535 isn't narrow.
+
+    Define CONST_DIVIDER_DIVIDE to 1 to use plain division everywhere,
+    e.g. to compare against.
+ */
+#ifndef CONST_DIVIDER_H
+#define CONST_DIVIDER_H
+
+#include <stdint.h>
+
+#ifndef CONST_DIVIDER_DIVIDE
+#define CONST_DIVIDER_DIVIDE 0
+#endif
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam D       Divisor
+    @tparam MAXN    Largest dividend (magnitude) the result must be exact for
+ */
+template<uint32_t D, uint32_t MAXN>
+class ConstDivider
+{
+    //---------------------------------------------------------
+    static constexpr uint64_t ceilDiv(uint64_t a, uint64_t b) { return (a + b - 1) / b; }
+    //---------------------------------------------------------
+    /// Power of two factor of D, shifted out before the multiply
+    static constexpr unsigned preShift()
+    {
+        unsigned b = 0;
+        while (((D >> b) & 1) == 0)
+            ++b;
+        return b;
+    }
+    //---------------------------------------------------------
+    static constexpr uint32_t oddD() { return D >> preShift(); }
+    //---------------------------------------------------------
+    static constexpr uint32_t oddMaxN() { return MAXN >> preShift(); }
+    //---------------------------------------------------------
+    /**
+        Smallest shift s where m = ceil(2^s/d) gives floor(n*m/2^s) == n/d
+        for all n <= N (d, N after the pre-shift). With e = m*d - 2^s the
+        error term is n*e/(d*2^s), which stays under the 1/d gap to the
+        next integer while n*e < 2^s.
+     */
+    static constexpr unsigned findShift()
+    {
+        unsigned s = 0;
+        while (s < 63 && uint64_t(oddMaxN()) * (ceilDiv(uint64_t(1) << s, oddD()) * oddD() - (uint64_t(1) << s)) >= (uint64_t(1) << s))
+            ++s;
+        return s;
+    }
+
+public:
+    /// Divisor is a power of two; just shift
+    static constexpr bool isPow2() { return oddD() == 1; }
+    //---------------------------------------------------------
+    static constexpr unsigned shift() { return isPow2() ? 0 : findShift(); }
+    //---------------------------------------------------------
+    static constexpr uint64_t multiplier() { return isPow2() ? 1 : ceilDiv(uint64_t(1) << shift(), oddD()); }
+    //---------------------------------------------------------
+    /// Product fits 32 bits, so no 64 bit multiply is needed
+    static constexpr bool isNarrow() { return uint64_t(oddMaxN()) * multiplier() <= 0xffffffffu; }
+    //---------------------------------------------------------
+    /// Product fits 48 bits, and its top 32 are all that's kept: mulShiftSplit()
+    static constexpr bool isSplit()
+    {
+        return !isPow2() && !isNarrow() && shift() >= 16 && multiplier() <= 0xffffffffu
+            && uint64_t(oddMaxN()) * multiplier() < (uint64_t(1) << 48);
+    }
+    //---------------------------------------------------------
+    /// Multiplier fits 32 bits, the product doesn't fit 48: mulShiftLong()
+    static constexpr bool isLong()
+    {
+        return !isPow2() && !isNarrow() && !isSplit() && multiplier() <= 0xffffffffu;
+    }
+    //---------------------------------------------------------
+    /**
+        (n * multiplier()) >> shift() from 16x16->32 products. With
+        n = nh:nl and m = mh:ml in 16 bit halves, the low 16 bits of
+        nl * ml only matter as the carry out of them, so
+
+            (n * m) >> 16 = (nh*mh << 16) + nh*ml + nl*mh + (nl*ml >> 16)
+
+        which isSplit() keeps under 2^32.
+     */
+    static constexpr uint32_t mulShiftSplit(uint32_t n)
+    {
+        return ((uint32_t(uint16_t(n >> 16)) * uint16_t(multiplier() >> 16) << 16)
+            + uint32_t(uint16_t(n >> 16)) * uint16_t(multiplier())
+            + uint32_t(uint16_t(n)) * uint16_t(multiplier() >> 16)
+            + ((uint32_t(uint16_t(n)) * uint16_t(multiplier())) >> 16)) >> (isSplit() ? shift() - 16 : 0);
+    }
+    //---------------------------------------------------------
+    /**
+        mulShiftSplit() for a product up to 64 bits: the same four
+        products, summed into a low and a high word with the carries
+        out of the middle 32 bits, then the pair shifted. The quotient
+        is at most n, so it fits 32 bits whatever the shift.
+     */
+    static constexpr uint32_t mulShiftLong(uint32_t n)
+    {
+        const uint32_t ll = uint32_t(uint16_t(n)) * uint16_t(multiplier());
+        const uint32_t lh = uint32_t(uint16_t(n)) * uint16_t(multiplier() >> 16);
+        const uint32_t hl = uint32_t(uint16_t(n >> 16)) * uint16_t(multiplier());
+        const uint32_t hh = uint32_t(uint16_t(n >> 16)) * uint16_t(multiplier() >> 16);
+        const uint32_t mid = (ll >> 16) + uint16_t(lh) + uint16_t(hl);
+        const uint32_t lo = (mid << 16) | uint16_t(ll);
+        const uint32_t hi = hh + (lh >> 16) + (hl >> 16) + (mid >> 16);
+        // shift() is a constant, so only one side is built
+        return shift() >= 32 ? hi >> (shift() & 31)
+            : (hi << ((32 - shift()) & 31)) | (lo >> (shift() & 31));
+    }
+    //---------------------------------------------------------
+    /// n / D for 0 <= n <= MAXN
+    static constexpr uint32_t div(uint32_t n)
+    {
+        return CONST_DIVIDER_DIVIDE ? n / D
+            : isPow2() ? n >> preShift()
+            : isNarrow() ? uint32_t(((n >> preShift()) * uint32_t(multiplier())) >> shift())
+            : isSplit() ? mulShiftSplit(n >> preShift())
+            : isLong() ? mulShiftLong(n >> preShift())
+            : uint32_t(((n >> preShift()) * multiplier()) >> shift());
+    }
+    //---------------------------------------------------------
+    /// n % D for 0 <= n <= MAXN
+    static constexpr uint32_t mod(uint32_t n)
+    {
+        return CONST_DIVIDER_DIVIDE ? n % D
+            : isPow2() ? n & (D - 1)
+            : n - div(n) * D;
+    }
+    //---------------------------------------------------------
+    /// n / D truncated toward zero, as C does, for |n| <= MAXN
+    static constexpr int32_t divSigned(int32_t n)
+    {
+        return CONST_DIVIDER_DIVIDE ? n / int32_t(D)
+            : n < 0 ? -int32_t(div(uint32_t(-n))) : int32_t(div(uint32_t(n)));
+    }
+    //---------------------------------------------------------
+    /**
+        Exhaustive check against real division over the whole domain.
+        @return true if every dividend in [-MAXN, MAXN] matches
+     */
+    static bool verify()
+    {
+        for (uint32_t n = 0; ; ++n)
+        {
+            if (div(n) != n / D || mod(n) != n % D)
+                return false;
+            if (divSigned(-int32_t(n)) != -int32_t(n) / int32_t(D))
+                return false;
+            if (n == MAXN)
+                return true;
+        }
+    }
+    //---------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,102 @@
+/** @file
+    1D lookup with one table entry per input count; no interpolation.
+
+    Same API as InterpolatedLookup1D, so it can stand in wherever the
+    memory is there: a 10 bit ADC costs 2KB of int16_t, which is cheap
+    on the host and larger MCUs and removes the partition, the second
+    load and the multiply from every sample.
+ */
+#ifndef DIRECT_LOOKUP_H
+#define DIRECT_LOOKUP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "InterpolatedLookup.h"
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam TT      Table intrinsic type
+    @tparam TR      Table real type
+    @tparam BITS    Input bits; the table has 2^BITS entries
+ */
+template<typename TT, typename TR, unsigned BITS>
+class DirectLookup1D : public LookupBase< DirectLookup1D<TT, TR, BITS> >
+{
+protected:
+    const TT* _table;
+    const TR _scale;
+    const float _scaleFactor;
+public:
+    typedef TT table_t;
+    typedef uint16_t index_t;
+    //----------------------------------------------------------
+    static constexpr index_t tableSize() { return index_t(1) << BITS; }
+    //----------------------------------------------------------
+    /// Table memory, for comparing against the interpolated layouts
+    static constexpr size_t tableBytes() { return tableSize() * sizeof(TT); }
+    //----------------------------------------------------------
+    constexpr DirectLookup1D(
+        const TT* table,
+        TR scale
+    )
+        :  _table(table),
+           _scale(scale),
+           _scaleFactor(1.0/scale)
+    {}
+    //----------------------------------------------------------
+    /// Get raw value in first entry
+    TT loRaw() const { return _table[0]; }
+    //----------------------------------------------------------
+    /// Get raw value in last entry
+    TT hiRaw() const { return _table[tableSize() - 1]; }
+    //----------------------------------------------------------
+    const TT* table() const { return _table; }
+    //----------------------------------------------------------
+    TR getScale() const { return _scale; }
+    //----------------------------------------------------------
+    float getScaleFactor() const { return _scaleFactor; }
+    //----------------------------------------------------------
+    TR scale(TT tv) const { return _scale * tv; }
+    //----------------------------------------------------------
+    TR lo() const { return scale(loRaw()); }
+    //----------------------------------------------------------
+    TR hi() const { return scale(hiRaw()); }
+    //----------------------------------------------------------
+    /**
+        Get the raw value for a given count.
+        @param count ADC counts; out of range counts clamp to the last entry
+        @return Table value
+     */
+    TT raw(index_t count) const
+    {
+        return count < tableSize() ? _table[count] : hiRaw();
+    }
+    //----------------------------------------------------------
+    /**
+        Get the scaled value for a given count.
+        @param count ADC counts
+        @return Scaled value
+     */
+    TR value(uint16_t count) const
+    {
+        return scale(raw(count));
+    }
+    //----------------------------------------------------------
+    /// raw() for a block of counts
+    void rawBatch(const index_t* counts, TT* out, size_t n) const
+    {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = raw(counts[i]);
+    }
+    //----------------------------------------------------------
+    /// value() for a block of counts
+    void valueBatch(const index_t* counts, TR* out, size_t n) const
+    {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = value(counts[i]);
+    }
+    //----------------------------------------------------------
+};
+
+#endif
@@ -1,9 +1,47 @@
 #ifndef _HS1101
 #define _HS1101
 
+#include <stddef.h>
 #include <stdint.h>
+#include "HS1101Batch.h"
+#include "HS1101Grid.h"
+#ifdef ARDUINO
 #include <Telemetry.h>
+#endif
 
+//========================================================================
+/**
+    Data classes generated with packed=True advertise _humid_table_packed
+    and store the humidity table as per column lines plus residues.
+ */
+template<typename T, typename = void>
+struct HS1101Packed
+{
+    static const bool value = false;
+};
+
+template<typename T>
+struct HS1101Packed<T, decltype(void(T::_humid_table_packed))>
+{
+    static const bool value = T::_humid_table_packed;
+};
+//========================================================================
+/**
+    Data classes generated with counts32=True, for oscillators or gates
+    that go past 16 bits of counts, advertise count_t; the rest count in
+    uint16_t.
+ */
+template<typename T, typename = void>
+struct HS1101Count
+{
+    typedef uint16_t type;
+};
+
+template<typename T>
+struct HS1101Count<T, decltype(void(sizeof(typename T::count_t)))>
+{
+    typedef typename T::count_t type;
+};
 //========================================================================
 /**
     Handle HS1101 Humidity sensor; this bit just does the computation.
@@ -13,7 +51,6 @@
 template<typename T>
 class HS1101 : public T
 {
-
 public:
     enum class Status
     {
@@ -21,6 +58,95 @@ public:
         HumidityLow, HumidityHigh,
         TempLow, TempHigh
     };
+
+    /// Humidity oscillator counts
+    typedef typename HS1101Count<T>::type count_t;
+
+protected:
+    typedef HS1101Grid<T> Grid;   ///< shifts for power of two grids, else divides
+
+    template<bool PACKED> struct Layout {};
+
+    /**
+     * Humidity table entry [row][column], whatever the layout. Not static,
+     * so a data class may hold its tables as members (HS1101Mapped.h).
+     */
+    int16_t cell(uint8_t r, uint8_t c) const
+    {
+        return cell(r, c, Layout<HS1101Packed<T>::value>());
+    }
+    int16_t cell(uint8_t r, uint8_t c, Layout<false>) const
+    {
+        return T::_hs1101_table[r][c];
+    }
+    /// Decoded from the column's line and the entry's residue
+    int16_t cell(uint8_t r, uint8_t c, Layout<true>) const
+    {
+        const auto& e = T::_hs1101_lines[c];
+        return e.base + r*e.slope + T::_hs1101_resid[r][c];
+    }
+    //--------------------------------------------------------------------
+    /// interpol() on table row r; only the two entries used are read
+    int16_t interpolCell(uint8_t r, uint16_t bucket, int16_t residue) const
+    {
+        auto rh00 = cell(r, bucket);
+        auto rh01 = cell(r, bucket + 1);
+
+        return rh00 + Grid::divH(int32_t(residue)*(rh01-rh00));
+    }
+    //--------------------------------------------------------------------
+    size_t batch(const uint16_t* countsHumid, const int16_t* tempRaw,
+                 int16_t* humidRaw, Status* status, size_t n, Layout<false>) const
+    {
+        return HS1101Batch<T, Status>::computeRH(
+            &T::_hs1101_table[0][0], countsHumid, tempRaw, humidRaw, status, n);
+    }
+    /// The vector kernel gathers from a plain table; packed ones go through computeRH()
+    size_t batch(const uint16_t*, const int16_t*, int16_t*, Status*, size_t, Layout<true>) const
+    {
+        return 0;
+    }
+    /// Its lanes are 16 bit counts too; wide ones go through computeRH()
+    template<typename C, bool PACKED>
+    size_t batch(const C*, const int16_t*, int16_t*, Status*, size_t, Layout<PACKED>) const
+    {
+        return 0;
+    }
+    //--------------------------------------------------------------------
+    /**
+     * The bilinear interpolation itself, on row tb0 plus tres of the way
+     * to the next; counts and temperature are already range checked.
+     * @return Humidity in RH%, scaled and clamped
+     */
+    int16_t interpolRH(uint8_t tb0, int16_t tres, count_t countsHumid) const
+    {
+        auto fadj = countsHumid - T::_humid_table_locount;
+        auto fb0  = Grid::divH(fadj);
+        auto fres = Grid::modH(fadj);
+
+        auto rh = interpolCell(tb0, fb0, fres);   // interpolate on row <= temp
+
+        if(tres!=0)
+        {
+            // have a residue in temp, so do an interpolation
+            // on the next temp row
+            auto rh1 = interpolCell(tb0+1, fb0, fres); // interpolate on row > temp
+
+            // and then use that
+            // to interpolate
+            auto rhd = rh1 - rh;
+            auto rhadj = Grid::divT(int32_t(tres)*rhd);
+            rh += rhadj;
+        }
+
+        if(rh <0)
+            return 0;
+        if(rh > T::_humid_max_raw)
+            return T::_humid_max_raw;
+        return rh;
+    }
+
+public:
     //--------------------------------------------------------------------
     HS1101()
     {}
@@ -52,12 +178,32 @@ public:
         return lb + adj;
     }
     //--------------------------------------------------------------------
+    /**
+     * rawTemp() from the interleaved {base, slope} thermistor table;
+     * one entry load, no subtract. Only for data classes generated with
+     * slopeLayout=True.
+     */
+    int16_t rawTempSlope(uint16_t adc) const
+    {
+        if(adc<=T::_therm_table_locount)
+            return T::_therm_slope_table[0].base;
+        else if(adc>=T::_therm_table_hicount)
+            return T::_therm_slope_table[T::_therm_table_size-1].base;
+
+        auto adc0 = adc - T::_therm_table_locount;
+        auto ix = adc0 >> T::_therm_table_rbits;
+        auto res = adc0 & T::_therm_table_rmask;
+
+        auto e = T::_therm_slope_table[ix];
+        return e.base + ((int32_t(e.slope)*res + (1 << T::_therm_slope_bits >> 1)) >> T::_therm_slope_bits);
+    }
+    //--------------------------------------------------------------------
     int16_t interpol(const int16_t* row, uint16_t bucket, int16_t residue)
     {
         auto rh00 = row[bucket];
         auto rh01 = row[bucket + 1];
 
-        auto rd = residue*(rh01-rh00)/T::_humid_table_stepH;
+        auto rd = Grid::divH(int32_t(residue)*(rh01-rh00));
 
         return rh00+rd;
     }
@@ -70,7 +216,7 @@ public:
      * @param[out]  humidRaw    Humidity in RH%, scaled
      * @return                  Conversion status
      */
-    Status computeRH(uint16_t countsHumid, int16_t tempRaw, int16_t& humidRaw)
+    Status computeRH(count_t countsHumid, int16_t tempRaw, int16_t& humidRaw)
     {
         //
         // can just do
@@ -100,38 +246,365 @@ public:
 
 
         auto tadj = tempRaw - T::_humid_table_tminsc;
-        auto tb0  = tadj / T::_humid_table_stepTsc;
-        auto tres = tadj % T::_humid_table_stepTsc;
+        auto tb0  = Grid::divT(tadj);
+        auto tres = Grid::modT(tadj);
+
+        humidRaw = interpolRH(tb0, tres, countsHumid);
+        return status;
+    }
+    //--------------------------------------------------------------------
+    /// Both conversions of a sample, and the status
+    struct Reading
+    {
+        int16_t tempRaw;
+        int16_t humidRaw;
+        Status  status;
+    };
+    //--------------------------------------------------------------------
+    /**
+     * rawTemp() and computeRH() in one pass: the temperature stays in a
+     * register and goes straight to the row selection, and out of range
+     * humidity skips the row selection. Same results as the two calls.
+     *
+     * @param adc           Thermistor ADC counts
+     * @param countsHumid   Humidity oscillator counts for sampling period
+     */
+    Reading convert(uint16_t adc, count_t countsHumid) const
+    {
+        Reading r;
+        r.tempRaw = rawTemp(adc);
+
+        if(countsHumid <= T::_humid_table_locount)
+        {
+            r.humidRaw = 0;
+            r.status = Status::HumidityLow;
+            return r;
+        }
+        if(countsHumid >= T::_humid_table_hicount)
+        {
+            r.humidRaw = 100*T::_humid_table_scale;
+            r.status = Status::HumidityHigh;
+            return r;
+        }
+
+        int16_t t = r.tempRaw;
+        r.status = Status::Ok;
+        if(t <= T::_humid_table_tminsc)
+        {
+            t = T::_humid_table_tminsc;
+            r.status = Status::TempLow;
+        }
+        else if(t >= T::_humid_table_tmaxsc)
+        {
+            t = T::_humid_table_tmaxsc;
+            r.status = Status::TempHigh;
+        }
+
+        auto tadj = t - T::_humid_table_tminsc;
+        r.humidRaw = interpolRH(Grid::divT(tadj), Grid::modT(tadj), countsHumid);
+        return r;
+    }
+    //--------------------------------------------------------------------
+    /**
+     * computeRH() over structure-of-arrays input, e.g. readings from many
+     * sensors. Vectorised, branch free, where the host has it
+     * (HS1101Batch.h); the rest, and everything on the AVR where a
+     * branch is cheaper than doing both sides, through computeRH().
+     *
+     * @param       countsHumid Humidity oscillator counts, n of them
+     * @param       tempRaw     Temps as from lookup table, n of them
+     * @param[out]  humidRaw    Humidity in RH%, scaled
+     * @param[out]  status      Conversion status per sample
+     * @param       n           Number of samples
+     */
+    void computeRHBatch(const count_t* countsHumid, const int16_t* tempRaw,
+                        int16_t* humidRaw, Status* status, size_t n)
+    {
+        size_t i = batch(countsHumid, tempRaw, humidRaw, status, n, Layout<HS1101Packed<T>::value>());
+
+        for (; i < n; ++i)
+            status[i] = computeRH(countsHumid[i], tempRaw[i], humidRaw[i]);
+    }
+    //--------------------------------------------------------------------
+};
+//========================================================================
+/**
+    HS1101 with a cached humidity row for the current temperature.
+
+    Temperature moves far slower than the humidity count, so the two
+    rows either side of it are blended into one row once, and rebuilt
+    only when the temperature moves more than a tolerance; each humidity
+    sample is then a single 1D interpolation.
+
+    Blending first and interpolating along the row second rounds in a
+    different order from computeRH(), so results can differ from it by
+    a count or so in table units, plus whatever the tolerance allows.
+
+    @tparam T   Thermistor and Humidity sensor base class
+ */
+template<typename T>
+class HS1101Cached : public HS1101<T>
+{
+public:
+    typedef typename HS1101<T>::Status Status;
+    typedef typename HS1101<T>::count_t count_t;
+
+private:
+    typedef typename HS1101<T>::Grid Grid;
+
+    int16_t _row[T::_humid_table_sizeH];
+    int16_t _rowTemp;       ///< clamped temp the row is for
+    int16_t _tolerance;     ///< raw temp change that forces a rebuild
+    bool _valid;
+    uint32_t _rebuilds;
+
+public:
+    //--------------------------------------------------------------------
+    /**
+     * @param tolerance Temp change, in raw units, before the row is
+     *                  rebuilt; default 0.5C, which moves RH by well under
+     *                  0.1% (RH depends only weakly on temperature)
+     */
+    HS1101Cached(int16_t tolerance = T::_therm_table_scale / 2)
+        : _rowTemp(0), _tolerance(tolerance), _valid(false), _rebuilds(0)
+    {}
+    //--------------------------------------------------------------------
+    void setTolerance(int16_t tolerance) { _tolerance = tolerance; }
+    //--------------------------------------------------------------------
+    /// Force a rebuild on the next sample
+    void invalidate() { _valid = false; }
+    //--------------------------------------------------------------------
+    /// Rows built so far, for tuning the tolerance
+    uint32_t rebuilds() const { return _rebuilds; }
+    //--------------------------------------------------------------------
+    /**
+     * Bring the row up to date for a temperature.
+     * @return Temperature status, as computeRH() would give it
+     */
+    Status setTemp(int16_t tempRaw)
+    {
+        Status status = Status::Ok;
+        if(tempRaw <= T::_humid_table_tminsc)
+        {
+            tempRaw = T::_humid_table_tminsc;
+            status = Status::TempLow;
+        }
+        else if(tempRaw >= T::_humid_table_tmaxsc)
+        {
+            tempRaw = T::_humid_table_tmaxsc;
+            status = Status::TempHigh;
+        }
+
+        int16_t d = tempRaw - _rowTemp;
+        if(_valid && d <= _tolerance && d >= -_tolerance)
+            return status;
+
+        auto tadj = tempRaw - T::_humid_table_tminsc;
+        auto tb0  = Grid::divT(tadj);
+        auto tres = Grid::modT(tadj);
+
+        auto tb1 = tres ? tb0+1 : tb0;
 
-        auto hrow = T::_hs1101_table[tb0++];
-        auto hrow2 = T::_hs1101_table[tb0];
+        for(uint16_t i=0; i<T::_humid_table_sizeH; ++i)
+        {
+            int16_t h0 = this->cell(tb0, i);
+            _row[i] = h0 + Grid::divT(int32_t(tres)*(this->cell(tb1, i)-h0));
+        }
+
+        _rowTemp = tempRaw;
+        _valid = true;
+        ++_rebuilds;
+        return status;
+    }
+    //--------------------------------------------------------------------
+    /**
+     * Humidity from the cached row, at the last setTemp() temperature.
+     * @param       countsHumid Humidity oscillator counts for sampling period
+     * @param[out]  humidRaw    Humidity in RH%, scaled
+     * @return                  Humidity status; Ok if in range
+     */
+    Status computeRowRH(count_t countsHumid, int16_t& humidRaw) const
+    {
+        if(countsHumid <= T::_humid_table_locount)
+        {
+            humidRaw = 0;
+            return Status::HumidityLow;
+        }
+        if(countsHumid >=T::_humid_table_hicount)
+        {
+            humidRaw = 100*T::_humid_table_scale;
+            return Status::HumidityHigh;
+        }
 
         auto fadj = countsHumid - T::_humid_table_locount;
-        auto fb0  = fadj / T::_humid_table_stepH;
-        auto fres = fadj % T::_humid_table_stepH;
+        auto fb0  = Grid::divH(fadj);
+        auto fres = Grid::modH(fadj);
 
-        auto rh = interpol(hrow, fb0, fres);   // interpolate on row <= temp
+        int32_t rh = _row[fb0] + Grid::divH(int32_t(fres)*(_row[fb0+1]-_row[fb0]));
 
-        if(tres!=0)
+        humidRaw = rh < 0 ? 0 : rh > T::_humid_max_raw ? T::_humid_max_raw : rh;
+        return Status::Ok;
+    }
+    //--------------------------------------------------------------------
+    /// computeRH() through the cache; same arguments and status
+    Status computeRHCached(count_t countsHumid, int16_t tempRaw, int16_t& humidRaw)
+    {
+        Status ts = setTemp(tempRaw);
+        Status hs = computeRowRH(countsHumid, humidRaw);
+        return hs != Status::Ok ? hs : ts;
+    }
+    //--------------------------------------------------------------------
+    /// A burst of humidity samples at one temperature
+    void computeRHBurst(const count_t* countsHumid, int16_t tempRaw,
+                        int16_t* humidRaw, Status* status, size_t n)
+    {
+        Status ts = setTemp(tempRaw);
+        for(size_t i=0; i<n; ++i)
         {
-            // have a residue in temp, so do an interpolation
-            // on the next temp row
-            auto rh1 = interpol(hrow2, fb0, fres); // interpolate on row > temp
+            Status hs = computeRowRH(countsHumid[i], humidRaw[i]);
+            status[i] = hs != Status::Ok ? hs : ts;
+        }
+    }
+    //--------------------------------------------------------------------
+};
+//========================================================================
+/**
+    HS1101 with a precomputed map from thermistor table bucket to
+    humidity table row, so convert() picks the row without dividing.
 
-            // and then use that
-            // to interpolate
-            auto rhd = rh1 - rh;
-            auto rhadj = tres*rhd/T::_humid_table_stepTsc;
-            rh += rhadj;
+    For each thermistor bucket the map holds the row of the bucket's
+    colder end and that row's scaled temperature; any temperature
+    interpolated in the bucket is at or above it, and can only pass
+    into the next row or so, which is a compare and subtract. Taking
+    the colder end, rather than the first entry, keeps that true for a
+    thermistor table falling with ADC count (NTC on the low side of the
+    divider) as well as a rising one. Same results as HS1101::convert().
+
+    This trades Grid::divT/modT for a table and a short loop; on x86,
+    where the divide by a constant is a multiply, it's slower than
+    convert() (bench/BenchHS1101Convert.cpp). It's only worth having
+    where the divide is a library call, i.e. generic grids on the AVR,
+    and that hasn't been measured.
+
+    The map is built from whatever tables the data class has at
+    construction; call buildRowMap() again if they change (e.g. after
+    HS1101MappedData::attach()).
+
+    @tparam T   Thermistor and Humidity sensor base class
+ */
+template<typename T>
+class HS1101RowMap : public HS1101<T>
+{
+public:
+    typedef typename HS1101<T>::Status Status;
+    typedef typename HS1101<T>::Reading Reading;
+    typedef typename HS1101<T>::count_t count_t;
+
+private:
+    typedef typename HS1101<T>::Grid Grid;
+
+    struct Row
+    {
+        int16_t start;      ///< scaled temperature of the row
+        uint8_t row;
+    };
+    Row _rows[T::_therm_table_size];
+
+public:
+    //--------------------------------------------------------------------
+    HS1101RowMap()
+    {
+        buildRowMap();
+    }
+    //--------------------------------------------------------------------
+    /// Rebuild the map from the current tables
+    void buildRowMap()
+    {
+        for(uint16_t i=0; i<T::_therm_table_size; ++i)
+        {
+            int16_t t = T::_therm_table[i];
+            if(i+1 < T::_therm_table_size && T::_therm_table[i+1] < t)
+                t = T::_therm_table[i+1];
+            uint8_t row = 0;
+            if(t > T::_humid_table_tminsc)
+            {
+                auto tadj = (t < T::_humid_table_tmaxsc ? t : T::_humid_table_tmaxsc) - T::_humid_table_tminsc;
+                row = Grid::divT(tadj);
+            }
+            _rows[i].row = row;
+            _rows[i].start = T::_humid_table_tminsc + row*T::_humid_table_stepTsc;
+        }
+    }
+    //--------------------------------------------------------------------
+    /// HS1101::convert(), the row from the map
+    Reading convert(uint16_t adc, count_t countsHumid) const
+    {
+        Reading r;
+        uint8_t ix;
+        if(adc<=T::_therm_table_locount)
+        {
+            ix = 0;
+            r.tempRaw = T::_therm_table[0];
+        }
+        else if(adc>=T::_therm_table_hicount)
+        {
+            ix = T::_therm_table_size-1;
+            r.tempRaw = T::_therm_table[ix];
+        }
+        else
+        {
+            auto adc0 = adc - T::_therm_table_locount;
+            ix = adc0 >> T::_therm_table_rbits;
+            auto res = adc0 & T::_therm_table_rmask;
+
+            auto lb = T::_therm_table[ix];
+            auto hb = T::_therm_table[ix+1];
+            r.tempRaw = lb + (((hb-lb)*res) >> T::_therm_table_rbits);
+        }
+
+        if(countsHumid <= T::_humid_table_locount)
+        {
+            r.humidRaw = 0;
+            r.status = Status::HumidityLow;
+            return r;
+        }
+        if(countsHumid >= T::_humid_table_hicount)
+        {
+            r.humidRaw = 100*T::_humid_table_scale;
+            r.status = Status::HumidityHigh;
+            return r;
         }
-        humidRaw = rh;
 
-        if(humidRaw <0)
-            humidRaw =0;
-        else if(humidRaw > T::_humid_max_raw)
-            humidRaw =T::_humid_max_raw;
+        uint8_t row;
+        int16_t tres;
+        if(r.tempRaw <= T::_humid_table_tminsc)
+        {
+            row = 0;
+            tres = 0;
+            r.status = Status::TempLow;
+        }
+        else
+        {
+            int16_t t = r.tempRaw;
+            r.status = Status::Ok;
+            if(t >= T::_humid_table_tmaxsc)
+            {
+                t = T::_humid_table_tmaxsc;
+                r.status = Status::TempHigh;
+            }
 
-        return status;
+            const Row& e = _rows[ix];
+            row = e.row;
+            tres = t - e.start;
+            while(tres >= T::_humid_table_stepTsc)
+            {
+                tres -= T::_humid_table_stepTsc;
+                ++row;
+            }
+        }
+
+        r.humidRaw = this->interpolRH(row, tres, countsHumid);
+        return r;
     }
     //--------------------------------------------------------------------
 };
@@ -0,0 +1,322 @@
+/** @file
+    Vectorised kernel behind HS1101::computeRHBatch().
+
+    Like InterpolatedLookupBatch.h: the kernel converts as many leading
+    samples as it can and returns how many it did, and computeRHBatch()
+    finishes the tail with computeRH(), so results are bit-identical to
+    calling computeRH() per sample.
+
+    There are no branches per sample: inputs are clamped into the table,
+    both rows are always interpolated (the second row is the first again
+    when the temperature sits on a row), and the out of range results
+    and status are blended in afterwards.
+
+    Compiled in for hosts that have the instructions: 8 lanes with
+    __AVX2__, 4 with plain __SSE2__ (the x86-64 default), which has no
+    gather, 32 bit multiply, min/max or blend, so those are done by hand
+    and it gains less. On the AVR it converts nothing.
+ */
+#ifndef HS1101_BATCH_H
+#define HS1101_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "HS1101Grid.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam T   HS1101 data class
+    @tparam TS  HS1101<T>::Status
+ */
+template<typename T, typename TS>
+struct HS1101Batch
+{
+#if defined(__AVX2__)
+    //---------------------------------------------------------
+    /// Truncating a/d for 8 int32 lanes; done in double, exact for int32 a
+    static __m256i div(__m256i a, double d)
+    {
+        const __m256d vd = _mm256_set1_pd(d);
+        __m128i lo = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a)), vd));
+        __m128i hi = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1)), vd));
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    }
+    //---------------------------------------------------------
+    /**
+        Truncating a/d in float, exact for |a| < 2^24: a converts exactly,
+        and a non-integer quotient is at least 1/d from an integer, more
+        than its rounding error of |a/d| * 2^-24.
+     */
+    static __m256i divf(__m256i a, float d)
+    {
+        return _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(a), _mm256_set1_ps(d)));
+    }
+    //---------------------------------------------------------
+    /**
+        a/step as HS1101Grid<T> does it: an arithmetic shift on power of
+        two grids, else a truncating divide, in float while |a| < 2^24.
+     */
+    static __m256i divStep(__m256i a, int32_t step, bool narrow)
+    {
+        if (HS1101Grid<T>::pow2)
+            return _mm256_sra_epi32(a, _mm_cvtsi32_si128(__builtin_ctz(step)));
+        return narrow ? divf(a, float(step)) : div(a, step);
+    }
+    //---------------------------------------------------------
+    /// Both ends of each lane's interpolation; gathers [ix] and [ix+1] as one int32
+    static void pair(const int16_t* table, __m256i ix, __m256i& a, __m256i& b)
+    {
+        __m256i p = _mm256_i32gather_epi32((const int*)table, ix, 2);
+        a = _mm256_srai_epi32(_mm256_slli_epi32(p, 16), 16);
+        b = _mm256_srai_epi32(p, 16);
+    }
+    //---------------------------------------------------------
+#elif defined(__SSE2__)
+    //---------------------------------------------------------
+    /**
+        a*k per lane for a and k in 0..32767, e.g. a row times its size.
+        SSE2 has no 32 bit mullo, but pmaddwd multiplies the 16 bit
+        halves into 32 bits, and k's top halves are 0.
+     */
+    static __m128i mulSmall(__m128i a, __m128i k)
+    {
+        return _mm_madd_epi16(a, k);
+    }
+    //---------------------------------------------------------
+    /// b where mask is set, else a
+    static __m128i select(__m128i a, __m128i b, __m128i mask)
+    {
+        return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b));
+    }
+    //---------------------------------------------------------
+    /// Truncating a/d for 4 int32 lanes; done in double, exact for int32 a
+    static __m128i div(__m128i a, double d)
+    {
+        const __m128d vd = _mm_set1_pd(d);
+        __m128i lo = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(a), vd));
+        __m128i hi = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(a, 0xee)), vd));
+        return _mm_unpacklo_epi64(lo, hi);
+    }
+    //---------------------------------------------------------
+    /// Truncating a/d in float, exact for |a| < 2^24, as the AVX2 divf()
+    static __m128i divf(__m128i a, float d)
+    {
+        return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(a), _mm_set1_ps(d)));
+    }
+    //---------------------------------------------------------
+    /// a/step as HS1101Grid<T> does it, as the AVX2 divStep()
+    static __m128i divStep(__m128i a, int32_t step, bool narrow)
+    {
+        if (HS1101Grid<T>::pow2)
+            return _mm_sra_epi32(a, _mm_cvtsi32_si128(__builtin_ctz(step)));
+        return narrow ? divf(a, float(step)) : div(a, step);
+    }
+    //---------------------------------------------------------
+    /**
+        divStep(a*b): the product is formed in float when narrow (exact
+        for |a*b| < 2^24), else in double (exact for any int32 product),
+        and divided there without going back to int32 in between.
+     */
+    static __m128i mulDivStep(__m128i a, __m128i b, int32_t step, bool narrow)
+    {
+        if (narrow)
+        {
+            __m128 p = _mm_mul_ps(_mm_cvtepi32_ps(a), _mm_cvtepi32_ps(b));
+            if (HS1101Grid<T>::pow2)
+                return divStep(_mm_cvttps_epi32(p), step, narrow);
+            return _mm_cvttps_epi32(_mm_div_ps(p, _mm_set1_ps(float(step))));
+        }
+        const __m128i ah = _mm_shuffle_epi32(a, 0xee), bh = _mm_shuffle_epi32(b, 0xee);
+        __m128d plo = _mm_mul_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b));
+        __m128d phi = _mm_mul_pd(_mm_cvtepi32_pd(ah), _mm_cvtepi32_pd(bh));
+        if (HS1101Grid<T>::pow2)
+            return divStep(_mm_unpacklo_epi64(_mm_cvttpd_epi32(plo), _mm_cvttpd_epi32(phi)), step, narrow);
+        const __m128d vd = _mm_set1_pd(step);
+        return _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_div_pd(plo, vd)), _mm_cvttpd_epi32(_mm_div_pd(phi, vd)));
+    }
+    //---------------------------------------------------------
+    /// Both ends of each lane's interpolation; no gather, so [ix] and [ix+1] as one int32 by hand
+    static void pair(const int16_t* table, __m128i ix, __m128i& a, __m128i& b)
+    {
+        int32_t k[4], w[4];
+        _mm_storeu_si128((__m128i*)k, ix);
+        for (int j = 0; j < 4; ++j)
+            memcpy(&w[j], table + k[j], sizeof(w[j]));
+        __m128i p = _mm_loadu_si128((const __m128i*)w);
+        a = _mm_srai_epi32(_mm_slli_epi32(p, 16), 16);
+        b = _mm_srai_epi32(p, 16);
+    }
+    //---------------------------------------------------------
+#endif
+    //---------------------------------------------------------
+    /**
+        computeRH() for 8 (AVX2) or 4 (SSE2) samples at a time.
+        @param table    T::_hs1101_table, flattened
+        @return         Samples converted
+     */
+    static size_t computeRH(const int16_t* table, const uint16_t* counts, const int16_t* temps,
+                            int16_t* humid, TS* status, size_t n)
+    {
+        size_t i = 0;
+#if defined(__AVX2__)
+        static_assert(sizeof(TS) == sizeof(int32_t), "status is stored as int32 lanes");
+        static_assert(int32_t(TS::Ok) == 0, "Ok is the all clear lane");
+
+        const __m256i locount = _mm256_set1_epi32(T::_humid_table_locount);
+        const __m256i hicount = _mm256_set1_epi32(T::_humid_table_hicount);
+        const __m256i tminsc = _mm256_set1_epi32(T::_humid_table_tminsc);
+        const __m256i tmaxsc = _mm256_set1_epi32(T::_humid_table_tmaxsc);
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i stepTsc = _mm256_set1_epi32(T::_humid_table_stepTsc);
+        const __m256i stepH = _mm256_set1_epi32(T::_humid_table_stepH);
+        const __m256i sizeH = _mm256_set1_epi32(T::_humid_table_sizeH);
+        const __m256i maxRaw = _mm256_set1_epi32(T::_humid_max_raw);
+        const __m256i full = _mm256_set1_epi32(100 * T::_humid_table_scale);
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256i c = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(counts + i)));
+            __m256i t = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(temps + i)));
+
+            __m256i hLo = _mm256_cmpgt_epi32(_mm256_add_epi32(locount, one), c);
+            __m256i hHi = _mm256_cmpgt_epi32(c, _mm256_sub_epi32(hicount, one));
+            __m256i tLo = _mm256_cmpgt_epi32(_mm256_add_epi32(tminsc, one), t);
+            __m256i tHi = _mm256_cmpgt_epi32(t, _mm256_sub_epi32(tmaxsc, one));
+
+            // clamp; out of range counts keep the indices in the table
+            t = _mm256_min_epi32(_mm256_max_epi32(t, tminsc), tmaxsc);
+            c = _mm256_min_epi32(_mm256_max_epi32(c, locount), _mm256_sub_epi32(hicount, one));
+
+            // row and column; offsets are small and >= 0, so exact in float
+            __m256i tadj = _mm256_sub_epi32(t, tminsc);
+            __m256i tb0 = divStep(tadj, T::_humid_table_stepTsc, true);
+            __m256i tres = _mm256_sub_epi32(tadj, _mm256_mullo_epi32(tb0, stepTsc));
+            __m256i tb1 = _mm256_sub_epi32(tb0, _mm256_cmpgt_epi32(tres, zero)); // row 2 only if used
+
+            __m256i fadj = _mm256_sub_epi32(c, locount);
+            __m256i fb0 = divStep(fadj, T::_humid_table_stepH, true);
+            __m256i fres = _mm256_sub_epi32(fadj, _mm256_mullo_epi32(fb0, stepH));
+
+            __m256i h00, h01, h10, h11;
+            pair(table, _mm256_add_epi32(_mm256_mullo_epi32(tb0, sizeH), fb0), h00, h01);
+            pair(table, _mm256_add_epi32(_mm256_mullo_epi32(tb1, sizeH), fb0), h10, h11);
+
+            // along the rows; (stepH-1)*|diff| is within float's 24 bits
+            // for steps up to 256, wider ones take the double divide
+            __m256i d0 = _mm256_mullo_epi32(fres, _mm256_sub_epi32(h01, h00));
+            __m256i d1 = _mm256_mullo_epi32(fres, _mm256_sub_epi32(h11, h10));
+            d0 = divStep(d0, T::_humid_table_stepH, T::_humid_table_stepH <= 256);
+            d1 = divStep(d1, T::_humid_table_stepH, T::_humid_table_stepH <= 256);
+            __m256i rh = _mm256_add_epi32(h00, d0);
+            __m256i rh1 = _mm256_add_epi32(h10, d1);
+
+            // and between them
+            rh = _mm256_add_epi32(rh,
+                divStep(_mm256_mullo_epi32(tres, _mm256_sub_epi32(rh1, rh)), T::_humid_table_stepTsc, false));
+
+            rh = _mm256_min_epi32(_mm256_max_epi32(rh, zero), maxRaw);
+            rh = _mm256_blendv_epi8(rh, full, hHi);
+            rh = _mm256_andnot_si256(hLo, rh);
+
+            __m256i st = _mm256_and_si256(tHi, _mm256_set1_epi32(int32_t(TS::TempHigh)));
+            st = _mm256_blendv_epi8(st, _mm256_set1_epi32(int32_t(TS::TempLow)), tLo);
+            st = _mm256_blendv_epi8(st, _mm256_set1_epi32(int32_t(TS::HumidityHigh)), hHi);
+            st = _mm256_blendv_epi8(st, _mm256_set1_epi32(int32_t(TS::HumidityLow)), hLo);
+
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(rh, rh), 0xd8);
+            _mm_storeu_si128((__m128i*)(humid + i), _mm256_castsi256_si128(packed));
+            _mm256_storeu_si256((__m256i*)(status + i), st);
+        }
+#elif defined(__SSE2__)
+        static_assert(sizeof(TS) == sizeof(int32_t), "status is stored as int32 lanes");
+        static_assert(int32_t(TS::Ok) == 0, "Ok is the all clear lane");
+        static_assert(T::_humid_table_stepTsc > 0 && T::_humid_table_stepH > 0
+            && T::_humid_table_sizeH < 0x8000, "mulSmall() takes 15 bit constants");
+
+        const __m128i locount = _mm_set1_epi32(T::_humid_table_locount);
+        const __m128i hicount = _mm_set1_epi32(T::_humid_table_hicount);
+        const __m128i tminsc = _mm_set1_epi32(T::_humid_table_tminsc);
+        const __m128i tmaxsc = _mm_set1_epi32(T::_humid_table_tmaxsc);
+        const __m128i one = _mm_set1_epi32(1);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i stepTsc = _mm_set1_epi32(T::_humid_table_stepTsc);
+        const __m128i stepH = _mm_set1_epi32(T::_humid_table_stepH);
+        const __m128i sizeH = _mm_set1_epi32(T::_humid_table_sizeH);
+        // SSE2 only has min/max for int16, so clamps are done 16 bits
+        // wide: counts biased by 0x8000 to compare them signed
+        const __m128i bias = _mm_set1_epi16(int16_t(0x8000));
+        const __m128i loBiased = _mm_set1_epi16(int16_t(T::_humid_table_locount ^ 0x8000));
+        const __m128i hiBiased = _mm_set1_epi16(int16_t((T::_humid_table_hicount - 1) ^ 0x8000));
+        const __m128i tmin16 = _mm_set1_epi16(T::_humid_table_tminsc);
+        const __m128i tmax16 = _mm_set1_epi16(T::_humid_table_tmaxsc);
+        const __m128i maxRaw = _mm_set1_epi16(T::_humid_max_raw);
+        const __m128i full = _mm_set1_epi16(100 * T::_humid_table_scale);
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128i c16 = _mm_loadl_epi64((const __m128i*)(counts + i));
+            __m128i t16 = _mm_loadl_epi64((const __m128i*)(temps + i));
+            __m128i c = _mm_unpacklo_epi16(c16, zero);
+            __m128i t = _mm_srai_epi32(_mm_unpacklo_epi16(t16, t16), 16);
+
+            __m128i hLo = _mm_cmpgt_epi32(_mm_add_epi32(locount, one), c);
+            __m128i hHi = _mm_cmpgt_epi32(c, _mm_sub_epi32(hicount, one));
+            __m128i tLo = _mm_cmpgt_epi32(_mm_add_epi32(tminsc, one), t);
+            __m128i tHi = _mm_cmpgt_epi32(t, _mm_sub_epi32(tmaxsc, one));
+
+            t16 = _mm_min_epi16(_mm_max_epi16(t16, tmin16), tmax16);
+            t = _mm_srai_epi32(_mm_unpacklo_epi16(t16, t16), 16);
+            c16 = _mm_min_epi16(_mm_max_epi16(_mm_xor_si128(c16, bias), loBiased), hiBiased);
+            c = _mm_unpacklo_epi16(_mm_xor_si128(c16, bias), zero);
+
+            __m128i tadj = _mm_sub_epi32(t, tminsc);
+            __m128i tb0 = divStep(tadj, T::_humid_table_stepTsc, true);
+            __m128i tres = _mm_sub_epi32(tadj, mulSmall(tb0, stepTsc));
+            __m128i tb1 = _mm_sub_epi32(tb0, _mm_cmpgt_epi32(tres, zero));
+
+            __m128i fadj = _mm_sub_epi32(c, locount);
+            __m128i fb0 = divStep(fadj, T::_humid_table_stepH, true);
+            __m128i fres = _mm_sub_epi32(fadj, mulSmall(fb0, stepH));
+
+            // row and column are within the table, so 15 bits
+            __m128i h00, h01, h10, h11;
+            pair(table, _mm_add_epi32(mulSmall(tb0, sizeH), fb0), h00, h01);
+            pair(table, _mm_add_epi32(mulSmall(tb1, sizeH), fb0), h10, h11);
+
+            const bool narrowH = T::_humid_table_stepH <= 256;
+            __m128i rh = _mm_add_epi32(h00, mulDivStep(fres, _mm_sub_epi32(h01, h00), T::_humid_table_stepH, narrowH));
+            __m128i rh1 = _mm_add_epi32(h10, mulDivStep(fres, _mm_sub_epi32(h11, h10), T::_humid_table_stepH, narrowH));
+
+            rh = _mm_add_epi32(rh,
+                mulDivStep(tres, _mm_sub_epi32(rh1, rh), T::_humid_table_stepTsc, false));
+
+            // interpolated between int16 entries, so the pack doesn't saturate
+            rh = _mm_packs_epi32(rh, rh);
+            rh = _mm_min_epi16(_mm_max_epi16(rh, zero), maxRaw);
+            rh = select(rh, full, _mm_packs_epi32(hHi, hHi));
+            rh = _mm_andnot_si128(_mm_packs_epi32(hLo, hLo), rh);
+
+            __m128i st = _mm_and_si128(tHi, _mm_set1_epi32(int32_t(TS::TempHigh)));
+            st = select(st, _mm_set1_epi32(int32_t(TS::TempLow)), tLo);
+            st = select(st, _mm_set1_epi32(int32_t(TS::HumidityHigh)), hHi);
+            st = select(st, _mm_set1_epi32(int32_t(TS::HumidityLow)), hLo);
+
+            _mm_storel_epi64((__m128i*)(humid + i), rh);
+            _mm_storeu_si128((__m128i*)(status + i), st);
+        }
+#else
+        (void)table; (void)counts; (void)temps; (void)humid; (void)status; (void)n;
+#endif
+        return i;
+    }
+    //---------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,359 @@
+/*
+* HS1101Generator.cpp
+*
+* C++ port of hs1101.py's Generator; see HS1101Generator.h.
+*/
+
+#ifndef ARDUINO
+
+#include "HS1101Generator.h"
+#include "CalImage.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+static const double AZ = 273.15;
+static const double T1 = AZ + 25;
+static const double TCOEFF = 0.04;  ///< pF/C
+
+/// Header as hs1101.py writes it; {key}s are filled in by header()
+static const char HEADER[] = R"TMPL(
+/** @file
+  @@brief HS1101 humidity sensor and thermistor
+  Generated by HS1101Generator
+  */
+#ifndef _{name}_table_H
+#define _{name}_table_H
+
+#include <stdint.h>
+#include "HS1101.h"
+{slopeinc}
+//=========================================================================================================================
+/** @brief
+ * Data class for HS1101
+ */     
+class {name}Data 
+{
+public:
+    static const uint16_t _therm_table_size    = {tsize}; ///< Entries in thermistor table
+    static const uint16_t _therm_table_scale   = {tscale5}; ///< Thermistor table values are multiplied by this value
+    static const uint16_t _therm_table_locount = {tlocount}; ///< ADC count for lowest bucket
+    static const uint16_t _therm_table_hicount = {thicount}; ///< ADC count for highest bucket
+    static const uint16_t _therm_table_rbits   = {tresiduebits}; ///< Bits in the residue
+    static const uint16_t _therm_table_rmask   = {trmask}; ///< Mask for the residue
+{slopeconst}
+
+    static const uint16_t _humid_table_sizeT   = {tcsize}; ///< Entries in dim0 of Humidity table (temp index)
+    static const int16_t  _humid_table_tmin    = {tmin}; ///< low temp in table (temp for first row)
+    static const int16_t  _humid_table_tmax    = {tmax}; ///< hi temp in table (temp for last row)
+    static const int16_t  _humid_table_tminsc  = {tminsc}; ///< low temp, scaled as per thermistor table (x{tscale})
+    static const int16_t  _humid_table_tmaxsc  = {tmaxsc}; ///< hi temp scaled as per thermistor table (x{tscale})
+    static const int16_t  _humid_table_stepT   = {tstep}; ///< Temperature distance between two rows
+    static const int16_t  _humid_table_stepTsc = {tstepsc}; ///< Temperature distance between two rows, scaled (x{tscale})
+                      
+    static const uint16_t _humid_table_sizeH   = {fcsize}; ///< Entries in dim1 of Humidity table (freq indexed)
+    static const {ctype} _humid_table_locount = {fcmin}; ///< Offset of first bucket (counts in interval)
+    static const {ctype} _humid_table_hicount = {fcmax}; ///< Offset of last bucket (counts in interval)
+    static const int16_t  _humid_table_stepH   = {fcstep}; ///< # counts between column values
+    static const uint16_t _humid_table_scale   = {hscale}; ///< Humidity table values are multiplied by this value
+    static const int16_t _humid_max_raw        = {hmaxraw}; ///< Humidity table values are multiplied by this value
+{countconst}{gridconst}{packconst}    
+    // CStray =  {cStrayPf}Pf
+
+    /// Scale a raw temp to °C
+    constexpr static double scaleTemp(int16_t raw) { return raw * {tscalf}; }
+                      
+    /// Scale a raw RH to RH% 
+    constexpr static double scaleHumid(int16_t raw) { return raw * {hscalf}; }
+                      
+protected:                      
+    static const int16_t  _therm_table[_therm_table_size];
+{slopedecl}{humiddecl}
+    
+};
+
+//=========================================================================================================================
+/**
+ Concrete HS1101 class with logic included
+ */
+class {name} : public HS1101<{name}Data>
+{
+};
+//=========================================================================================================================
+                      
+#endif
+)TMPL";
+
+//----------------------------------------------------
+static std::string format(const char* f, ...)
+{
+    char buf[256];
+    va_list ap;
+    va_start(ap, f);
+    vsnprintf(buf, sizeof(buf), f, ap);
+    va_end(ap);
+    return buf;
+}
+//----------------------------------------------------
+/// Shortest text that reads back as the same double, as Python's repr
+static std::string repr(double v)
+{
+    char buf[32];
+    for (int prec = 1; prec <= 17; ++prec)
+    {
+        snprintf(buf, sizeof(buf), "%.*g", prec, v);
+        if (strtod(buf, nullptr) == v)
+            break;
+    }
+    return buf;
+}
+//----------------------------------------------------
+/// Resistance for a name, as hs1101.py's fmt(): 150000 -> "150k0"
+static std::string ohms(double r)
+{
+    std::string s = r > 1e6 ? format("%.1f", r / 1e6) : r > 1e3 ? format("%.1f", r / 1e3) : format("%.1f", r);
+    s[s.find('.')] = r > 1e6 ? 'M' : r > 1e3 ? 'k' : 'R';
+    return s;
+}
+//----------------------------------------------------
+/// Replace every {key} in text
+static void fill(std::string& text, const char* key, const std::string& value)
+{
+    std::string k = std::string("{") + key + "}";
+    for (size_t at = text.find(k); at != std::string::npos; at = text.find(k, at + value.size()))
+        text.replace(at, k.size(), value);
+}
+//----------------------------------------------------
+HS1101Generator::HS1101Generator(const HS1101GenParams& p)
+    :   _p(p),
+        _tadcmax((1 << p.tadcbits) - 1),
+        _tlowbucket(0),
+        _thibucket(0),
+        _sizeT(0),
+        _sizeH(0)
+{
+    if (_p.pow2)
+    {
+        _p.tstep = 8;
+        _p.tscale = 128;
+        _p.fcstep = 128;
+    }
+
+    if (_p.name.empty())
+    {
+        std::string stray = _p.cStrayPf ? "Cstray" + repr(_p.cStrayPf) : "";
+        size_t dot = stray.find('.');
+        if (dot != std::string::npos)
+            stray[dot] = '_';
+        std::string tlo = format("%d", _p.tmin);
+        if (tlo[0] == '-')
+            tlo[0] = '_';
+        std::string osc = _p.rOsc == 402700 ? "" : "Ro" + ohms(_p.rOsc);
+        _p.name = "HS1101Rt" + ohms(_p.rth) + "Rs" + ohms(_p.rsense) + "Tl" + tlo
+            + "Th" + format("%d", _p.tmax) + (_p.sh.isSet() ? "SH" : "") + osc + stray + (_p.pow2 ? "P2" : "")
+            + (_p.counts32 ? "W32" : "");
+    }
+
+    // ranges as Python's range(lo, hi + step, step)
+    _sizeT = (_p.tmax + _p.tstep - _p.tmin + _p.tstep - 1) / _p.tstep;
+    _sizeH = (_p.fcmax + _p.fcstep - _p.fcmin + _p.fcstep - 1) / _p.fcstep;
+}
+//----------------------------------------------------
+double HS1101Generator::rhFromCapTemp(double cap, double temp)
+{
+    // c * (a rh^3 + b rh^2 + d rh + e) = cap; f' > 0 everywhere, and
+    // from the inflection point Newton walks straight to the root
+    const double c = 180 + temp * TCOEFF;
+    const double a = 1.25e-7, b = -1.36e-5, d = 2.19e-3, e = 9.0e-1;
+
+    double rh = -b / (3 * a);
+    for (int i = 0; i < 100; ++i)
+    {
+        double f = c * (((a * rh + b) * rh + d) * rh + e) - cap;
+        double df = c * ((3 * a * rh + 2 * b) * rh + d);
+        double dx = f / df;
+        rh -= dx;
+        if (fabs(dx) <= 1e-13 * (1 + fabs(rh)))
+            break;
+    }
+    return rh;
+}
+//----------------------------------------------------
+double HS1101Generator::capFromRHTemp(double rh, double temp)
+{
+    const double c = 180 + temp * TCOEFF;
+    return c * (((1.25e-7 * rh - 1.36e-5) * rh + 2.19e-3) * rh + 9.0e-1);
+}
+//----------------------------------------------------
+double HS1101Generator::capFromCounts(double counts) const
+{
+    return 0.725 / (_p.rOsc * counts) * 1e12 - _p.cStrayPf;
+}
+//----------------------------------------------------
+double HS1101Generator::countsFromCap(double cap) const
+{
+    return 0.725e12 / (_p.rOsc * (cap + _p.cStrayPf));
+}
+//----------------------------------------------------
+double HS1101Generator::tempForCounts(double counts) const
+{
+    double r = _p.rsense * (1 / (counts / _tadcmax) - 1);
+    if (_p.sh.isSet())
+        return _p.sh.tempFromResistance(r);
+    return 1 / (1 / T1 - log(_p.rth / r) / _p.beta) - AZ;
+}
+//----------------------------------------------------
+int HS1101Generator::countsAtTemp(double t) const
+{
+    double r = _p.sh.isSet() ? _p.sh.resistanceAtTemp(t) : _p.rth / exp(_p.beta * (1.0 / T1 - 1.0 / (t + AZ)));
+    return int(_tadcmax * (_p.rsense / (_p.rsense + r)) + 0.5);
+}
+//----------------------------------------------------
+void HS1101Generator::generate(unsigned threads)
+{
+    _tlowbucket = countsAtTemp(_p.tmin) >> _p.tresiduebits;
+    _thibucket = (countsAtTemp(_p.tmax) >> _p.tresiduebits) + 1;
+
+    _therm.clear();
+    for (int b = _tlowbucket; b <= _thibucket; ++b)
+        _therm.push_back(int16_t(tempForCounts(b << _p.tresiduebits) * _p.tscale + 0.5));
+
+    _humid.assign(size_t(_sizeT) * _sizeH, 0);
+    auto row = [this](int r)
+    {
+        double t = _p.tmin + r * _p.tstep;
+        for (int h = 0; h < _sizeH; ++h)
+        {
+            double rh = rhFromCapTemp(capFromCounts(_p.fcmin + h * _p.fcstep), t);
+            _humid[size_t(r) * _sizeH + h] = int16_t(rh * _p.hscale + 0.5);
+        }
+    };
+
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads > unsigned(_sizeT))
+        threads = _sizeT;
+
+    if (threads <= 1)
+    {
+        for (int r = 0; r < _sizeT; ++r)
+            row(r);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    for (unsigned n = 0; n < threads; ++n)
+        pool.emplace_back([&row, n, threads, this]()
+        {
+            for (int r = int(n); r < _sizeT; r += int(threads))
+                row(r);
+        });
+    for (std::thread& th : pool)
+        th.join();
+}
+//----------------------------------------------------
+std::string HS1101Generator::header() const
+{
+    std::string h = HEADER + 1;     // the raw string starts with a newline
+
+    std::string grid;
+    if (_p.pow2)
+        grid = format("    static const uint16_t _humid_table_shiftH  = %5d; ///< stepH is 1 << this\n", ilogb(_p.fcstep))
+            + format("    static const uint16_t _humid_table_shiftTsc= %5d; ///< stepTsc is 1 << this\n", ilogb(_p.tstep * _p.tscale));
+
+    fill(h, "name", _p.name);
+    fill(h, "slopeinc", "");
+    fill(h, "slopeconst", "");
+    fill(h, "slopedecl", "");
+    fill(h, "packconst", "");
+    fill(h, "gridconst", grid);
+    fill(h, "countconst", _p.counts32 ? "    typedef uint32_t count_t; ///< Humidity oscillator counts\n" : "");
+    fill(h, "ctype", _p.counts32 ? "uint32_t" : "uint16_t");
+    fill(h, "humiddecl", "    static const int16_t  _hs1101_table[_humid_table_sizeT][_humid_table_sizeH];\n");
+    fill(h, "tsize", format("%5d", int(_therm.size())));
+    fill(h, "tscale5", format("%5d", _p.tscale));
+    fill(h, "tscale", format("%d", _p.tscale));
+    fill(h, "tlocount", format("%5d", thermLoCount()));
+    fill(h, "thicount", format("%5d", thermHiCount()));
+    fill(h, "tresiduebits", format("%5d", _p.tresiduebits));
+    fill(h, "trmask", format("%5d", (1 << _p.tresiduebits) - 1));
+    fill(h, "tcsize", format("%5d", _sizeT));
+    fill(h, "tminsc", format("%5d", _p.tmin * _p.tscale));
+    fill(h, "tmaxsc", format("%5d", _p.tmax * _p.tscale));
+    fill(h, "tmin", format("%5d", _p.tmin));
+    fill(h, "tmax", format("%5d", _p.tmax));
+    fill(h, "tstepsc", format("%5.0f", double(_p.tstep * _p.tscale)));
+    fill(h, "tstep", format("%5.0f", double(_p.tstep)));
+    fill(h, "fcsize", format("%5d", _sizeH));
+    fill(h, "fcmin", format("%5d", _p.fcmin));
+    fill(h, "fcmax", format("%5d", _p.fcmax));
+    fill(h, "fcstep", format("%5.0f", double(_p.fcstep)));
+    fill(h, "hscale", format("%5d", _p.hscale));
+    fill(h, "hmaxraw", format("%5d", _p.hscale * 100));
+    fill(h, "cStrayPf", repr(_p.cStrayPf));
+    fill(h, "tscalf", repr(1.0 / _p.tscale));
+    fill(h, "hscalf", repr(1.0 / _p.hscale));
+    return h;
+}
+//----------------------------------------------------
+std::string HS1101Generator::source() const
+{
+    std::string s = "/// HS1101 cap>humidity\n\n#include \"" + _p.name + ".h\"\n\n";
+
+    s += "\nconst int16_t " + _p.name + "Data::_therm_table[_therm_table_size] = \n{\n";
+    for (size_t i = 0; i < _therm.size(); ++i)
+    {
+        int c = (_tlowbucket + int(i)) << _p.tresiduebits;
+        double r = _p.rsense * (1 / (double(c) / _tadcmax) - 1);
+        s += format("  %6d, // [%2d]%6.2f°C %6dcts %.3fV res=%.1fk\n", _therm[i], int(i),
+            tempForCounts(c), c, _p.volts * c / _tadcmax, r / 1000);
+    }
+    s += "};\n";
+
+    s += "\nconst int16_t " + _p.name + "Data::_hs1101_table[_humid_table_sizeT][_humid_table_sizeH] = \n{\n";
+    for (int r = 0; r < _sizeT; ++r)
+    {
+        double t = _p.tmin + r * _p.tstep;
+        s += "  {\n";
+        for (int h = 0; h < _sizeH; ++h)
+        {
+            int c = _p.fcmin + h * _p.fcstep;
+            int16_t v = _humid[size_t(r) * _sizeH + h];
+            s += format("    %6d, // [%d,%d] %6.2fRH%% %5dcts %5.2fpF @%6.2f°C\n", v, r, h,
+                rhFromCapTemp(capFromCounts(c), t), c, 1.8e-6 / c * 1e12, t);
+        }
+        s += "  },";
+    }
+    s += "\n};\n";
+    return s;
+}
+//----------------------------------------------------
+bool HS1101Generator::save(const std::string& dir) const
+{
+    const std::string text[2] = { header(), source() };
+    const char* ext[2] = { ".h", ".cpp" };
+    for (int i = 0; i < 2; ++i)
+    {
+        FILE* f = fopen((dir + _p.name + ext[i]).c_str(), "wb");
+        if (!f)
+            return false;
+        bool ok = fwrite(text[i].data(), 1, text[i].size(), f) == text[i].size();
+        if (fclose(f) != 0 || !ok)
+            return false;
+    }
+    return true;
+}
+//----------------------------------------------------
+void HS1101Generator::write(CalImageWriter& w, uint32_t sensorId) const
+{
+    w.addProfile(sensorId);
+    w.addTable(CalRole::Thermistor, uint16_t(_p.tscale),
+        CalAxis{ thermLoCount(), thermHiCount(), 1 << _p.tresiduebits }, uint16_t(_therm.size()), _therm.data());
+    w.addTable(CalRole::Humidity, uint16_t(_p.hscale),
+        CalAxis{ _p.tmin * _p.tscale, _p.tmax * _p.tscale, _p.tstep * _p.tscale }, uint16_t(_sizeT),
+        CalAxis{ _p.fcmin, _p.fcmax, _p.fcstep }, uint16_t(_sizeH), _humid.data());
+}
+
+#endif
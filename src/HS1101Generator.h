@@ -0,0 +1,127 @@
+/** @file
+    HS1101 table generator in C++: the same tables as hs1101.py, in
+    milliseconds, for regenerating per device tables at provisioning.
+
+    hs1101.py bisects the capacitance cubic 54 times per cell; here it is
+    inverted with Newton's method. The cubic's derivative has no real
+    root, so it is monotonic and Newton started at its inflection point
+    converges without bracketing. Rows are independent and are filled in
+    parallel.
+
+    The result is either in memory (thermTable(), humidTable(), or a
+    CalImage profile through write()) or the .h/.cpp pair hs1101.py
+    would emit, plain or pow2 layout.
+
+        HS1101GenParams p;
+        p.rsense = 150000;
+        p.cStrayPf = 8;
+        HS1101Generator g(p);
+        g.generate();
+        g.save("src/");
+
+    Host only; not built for ARDUINO.
+ */
+#ifndef HS1101_GENERATOR_H
+#define HS1101_GENERATOR_H
+
+#ifndef ARDUINO
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "SteinhartHart.h"
+
+class CalImageWriter;
+
+//-----------------------------------------------
+/// Generator options; names and defaults as hs1101.py's Generator
+struct HS1101GenParams
+{
+    double rsense = 100000;     ///< thermistor load resistor
+    double rth = 100000;        ///< thermistor R25
+    double beta = 3950;
+    SteinhartHart<double> sh = { 0, 0, 0 }; ///< replaces rth/beta when set
+    double volts = 3.3;         ///< ADC reference, for comments only
+    double rOsc = 402700;       ///< oscillator resistor, 10kHz nominal
+    double cStrayPf = 0;
+    int tmin = -10;             ///< first humidity row, C
+    int tmax = 110;             ///< last humidity row, C
+    int tstep = 10;             ///< C between rows
+    int tscale = 127;           ///< thermistor table values are C times this
+    int tadcbits = 10;
+    int tresiduebits = 5;
+    int hscale = 256;           ///< humidity table values are RH% times this
+    int fcmin = 8500;           ///< first humidity column, counts
+    int fcmax = 10800;          ///< counts at or past this are HumidityHigh
+    int fcstep = 100;           ///< counts between columns
+    bool pow2 = false;          ///< power of two grid; sets tstep 8, tscale 128, fcstep 128
+    bool counts32 = false;      ///< count_t is uint32_t, for counts past 16 bits
+    std::string name;           ///< class name; empty for hs1101.py's
+};
+//-----------------------------------------------
+//-----------------------------------------------
+class HS1101Generator
+{
+    HS1101GenParams _p;
+    int _tadcmax;
+    int _tlowbucket, _thibucket;
+    int _sizeT, _sizeH;
+    std::vector<int16_t> _therm;
+    std::vector<int16_t> _humid;    ///< row major
+
+public:
+    explicit HS1101Generator(const HS1101GenParams& p);
+
+    //----------------------------------------------------------
+    /// RH% for a capacitance (pF) at a temperature; the cubic's root
+    static double rhFromCapTemp(double cap, double temp);
+
+    /// Capacitance, pF, at RH% and a temperature; the cubic itself
+    static double capFromRHTemp(double rh, double temp);
+
+    /// Capacitance, pF, for oscillator counts in a 1s gate
+    double capFromCounts(double counts) const;
+
+    /// Oscillator counts in a 1s gate for a capacitance, pF
+    double countsFromCap(double cap) const;
+
+    /// Thermistor temperature, C, for ADC counts
+    double tempForCounts(double counts) const;
+
+    /// ADC counts, rounded, at a temperature
+    int countsAtTemp(double t) const;
+
+    //----------------------------------------------------------
+    /**
+        Fill both tables.
+        @param threads  Threads to fill humidity rows with; 0 for one per core
+     */
+    void generate(unsigned threads = 0);
+
+    //----------------------------------------------------------
+    const HS1101GenParams& params() const { return _p; }
+    const std::string& name() const { return _p.name; }
+
+    const std::vector<int16_t>& thermTable() const { return _therm; }
+    uint16_t thermLoCount() const { return uint16_t(_tlowbucket << _p.tresiduebits); }
+    uint16_t thermHiCount() const { return uint16_t(_thibucket << _p.tresiduebits); }
+
+    const std::vector<int16_t>& humidTable() const { return _humid; }
+    int sizeT() const { return _sizeT; }
+    int sizeH() const { return _sizeH; }
+
+    //----------------------------------------------------------
+    /// The header hs1101.py would write
+    std::string header() const;
+    /// The source hs1101.py would write
+    std::string source() const;
+    /// Write name().h and name().cpp into dir ("" or ending in '/')
+    bool save(const std::string& dir = "") const;
+
+    /// Add the tables to a calibration image as a profile, as HS1101MappedData::write()
+    void write(CalImageWriter& w, uint32_t sensorId) const;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,56 @@
+/** @file
+    Row and column arithmetic for the HS1101 humidity table.
+
+    Data classes generated with pow2=True advertise their steps as shifts
+    (_humid_table_shiftH, _humid_table_shiftTsc); HS1101Grid then divides
+    with shifts and masks, otherwise it falls back to / and %. The AVR has
+    no divide instruction, so each / or % on a generic grid is a library
+    call (__divmodhi4 / __divmodsi4) of a few hundred cycles.
+
+    Bucket and residue are only asked of values >= 0, where shift and
+    divide agree. The interpolation steps divide signed products; there
+    the shift floors where the divide truncates, so pow2 results can sit
+    one table unit lower on falling rows.
+
+    Each works in its argument's type, so buckets stay 16 bit on the AVR
+    and only the interpolation products need 32.
+ */
+#ifndef HS1101_GRID_H
+#define HS1101_GRID_H
+
+#include <stdint.h>
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Generic grid, any step.
+    @tparam T   HS1101 data class
+ */
+template<typename T, typename = void>
+struct HS1101Grid
+{
+    static const bool pow2 = false;
+
+    template<typename V> static V divH(V x) { return x / T::_humid_table_stepH; }
+    template<typename V> static V modH(V x) { return x % T::_humid_table_stepH; }
+    template<typename V> static V divT(V x) { return x / T::_humid_table_stepTsc; }
+    template<typename V> static V modT(V x) { return x % T::_humid_table_stepTsc; }
+};
+
+//-----------------------------------------------
+/// Power of two grid, shift and mask
+template<typename T>
+struct HS1101Grid<T, decltype(void(T::_humid_table_shiftH + T::_humid_table_shiftTsc))>
+{
+    static const bool pow2 = true;
+
+    static_assert(T::_humid_table_stepH == 1 << T::_humid_table_shiftH, "stepH must be 1 << shiftH");
+    static_assert(T::_humid_table_stepTsc == 1 << T::_humid_table_shiftTsc, "stepTsc must be 1 << shiftTsc");
+
+    template<typename V> static V divH(V x) { return x >> T::_humid_table_shiftH; }
+    template<typename V> static V modH(V x) { return x & (T::_humid_table_stepH - 1); }
+    template<typename V> static V divT(V x) { return x >> T::_humid_table_shiftTsc; }
+    template<typename V> static V modT(V x) { return x & (T::_humid_table_stepTsc - 1); }
+};
+
+#endif
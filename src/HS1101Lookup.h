@@ -0,0 +1,96 @@
+/** @file
+    HS1101 humidity on InterpolatedLookupND.
+
+    The humidity table is a 2D lookup, temperature rows by oscillator
+    count columns, and HS1101Lookup<T> runs it as one: a
+    ScaledOffsetPartitioner per axis from T's grid constants, behind
+    HS1101's out of range policy (HumidityLow / HumidityHigh report 0 and
+    100%, temperature clamps to T's tminsc / tmaxsc).
+
+        HS1101Lookup<HS1101Rt100k0Rs100k0Tl_10Th110Data> s;
+        s.computeRH(counts, s.rawTemp(adc), rh);
+
+    It matches HS1101::computeRH() exactly. On pow2 grids HS1101 floors
+    its interpolation steps with shifts (HS1101Grid.h), so the axes ask
+    the lookup to floor too, rather than truncate.
+ */
+#ifndef HS1101_LOOKUP_H
+#define HS1101_LOOKUP_H
+
+#include <stdint.h>
+#include "HS1101.h"
+#include "InterpolatedLookupND.h"
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam T   Generated HS1101 data class (not packed)
+ */
+template<typename T>
+class HS1101Lookup : public HS1101<T>
+{
+    static_assert(!HS1101Packed<T>::value, "packed tables aren't a plain grid");
+
+public:
+    typedef typename HS1101<T>::Status Status;
+    typedef typename HS1101<T>::count_t count_t;
+
+    /// Temperature rows, scaled as the thermistor table
+    struct TempAxis : ScaledOffsetPartitioner<int16_t, T::_humid_table_sizeT,
+        T::_humid_table_stepTsc, T::_humid_table_tminsc>
+    {
+        static const bool floors = HS1101Grid<T>::pow2;   ///< as Grid::divT()
+    };
+    /// Oscillator count columns
+    struct CountsAxis : ScaledOffsetPartitioner<count_t, T::_humid_table_sizeH,
+        T::_humid_table_stepH, T::_humid_table_locount>
+    {
+        static const bool floors = HS1101Grid<T>::pow2;   ///< as Grid::divH()
+    };
+    typedef InterpolatedLookupND<int16_t, float, TempAxis, CountsAxis> lookup_t;
+
+    //--------------------------------------------------------------------
+    /// HS1101::computeRH(), through the 2D lookup
+    Status computeRH(count_t countsHumid, int16_t tempRaw, int16_t& humidRaw) const
+    {
+        // T's range can stop short of the grid's last row and column
+        // (pow2 grids round the steps), so its ends are checked here
+        // and the lookup's own clamps don't come into it
+        if(countsHumid <= T::_humid_table_locount)
+        {
+            humidRaw = 0;
+            return Status::HumidityLow;
+        }
+        if(countsHumid >= T::_humid_table_hicount)
+        {
+            humidRaw = 100*T::_humid_table_scale;
+            return Status::HumidityHigh;
+        }
+
+        Status status = Status::Ok;
+        if(tempRaw <= T::_humid_table_tminsc)
+        {
+            tempRaw = T::_humid_table_tminsc;
+            status = Status::TempLow;
+        }
+        else if(tempRaw >= T::_humid_table_tmaxsc)
+        {
+            tempRaw = T::_humid_table_tmaxsc;
+            status = Status::TempHigh;
+        }
+
+        const int32_t v[] = { tempRaw, int32_t(countsHumid) };
+        LookupStatus s;
+        int16_t rh = lookup_t::rawFrom(&T::_hs1101_table[0][0], v, s);
+
+        if(rh < 0)
+            rh = 0;
+        else if(rh > T::_humid_max_raw)
+            rh = T::_humid_max_raw;
+        humidRaw = rh;
+        return status;
+    }
+    //--------------------------------------------------------------------
+};
+
+#endif
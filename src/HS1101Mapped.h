@@ -0,0 +1,128 @@
+/** @file
+    HS1101 running on tables mapped from a calibration image.
+
+    HS1101MappedData<B> keeps B's constants but holds its thermistor and
+    humidity tables as pointers, so HS1101's own rawTemp()/computeRH()
+    run on a sensor's profile in place:
+
+        CalImageFile image;
+        image.open("/var/lib/psi/cal.bin");
+        HS1101Mapped<HS1101Rt100k0Rs100k0Tl_10Th110Data> s;
+        if (s.attach(*image.find(sensorId)))
+            s.computeRH(counts, s.rawTemp(adc), rh);
+
+    A profile is only taken if its tables have exactly B's shape; until
+    one is attached the compiled in tables are used.
+ */
+#ifndef HS1101_MAPPED_H
+#define HS1101_MAPPED_H
+
+#include <stdint.h>
+#include "CalImage.h"
+#include "HS1101.h"
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam B   Generated HS1101 data class (not packed)
+ */
+template<typename B>
+class HS1101MappedData : public B
+{
+    static_assert(!HS1101Packed<B>::value, "packed tables can't be mapped");
+
+    typedef int16_t Row[B::_humid_table_sizeH];
+
+protected:
+    const int16_t* _therm_table;
+    const Row* _hs1101_table;
+
+    //----------------------------------------------------------
+    static bool same(const CalAxis& a, const CalAxis& b)
+    {
+        return a.lo == b.lo && a.hi == b.hi && a.step == b.step;
+    }
+
+public:
+    //----------------------------------------------------------
+    HS1101MappedData()
+        :   _therm_table(B::_therm_table),
+            _hs1101_table(B::_hs1101_table)
+    {}
+    //----------------------------------------------------------
+    /// ADC counts, as HS1101::rawTemp() partitions them
+    static CalAxis thermAxis()
+    {
+        return CalAxis{ B::_therm_table_locount, B::_therm_table_hicount, 1 << B::_therm_table_rbits };
+    }
+    /// Humidity table rows, scaled temperature
+    static CalAxis tempAxis()
+    {
+        return CalAxis{ B::_humid_table_tminsc, B::_humid_table_tmaxsc, B::_humid_table_stepTsc };
+    }
+    /// Humidity table columns, oscillator counts
+    static CalAxis countAxis()
+    {
+        return CalAxis{ B::_humid_table_locount, B::_humid_table_hicount, B::_humid_table_stepH };
+    }
+    //----------------------------------------------------------
+    /**
+        Use a profile's tables in place.
+        @return false, and the current tables kept, if the profile doesn't
+                have both tables in this data class's shape
+     */
+    bool attach(const CalProfile& p)
+    {
+        const CalTable* t = CalImage::table(p, CalRole::Thermistor);
+        const CalTable* h = CalImage::table(p, CalRole::Humidity);
+        if (!t || !h)
+            return false;
+
+        if (t->dims != 1 || t->rows != B::_therm_table_size || t->scale != B::_therm_table_scale
+            || !same(t->axis[0], thermAxis()))
+            return false;
+
+        if (h->dims != 2 || h->rows != B::_humid_table_sizeT || h->cols != B::_humid_table_sizeH
+            || h->scale != B::_humid_table_scale
+            || !same(h->axis[0], tempAxis()) || !same(h->axis[1], countAxis()))
+            return false;
+
+        _therm_table = CalImage::values(p, *t);
+        _hs1101_table = reinterpret_cast<const Row*>(CalImage::values(p, *h));
+        return true;
+    }
+    //----------------------------------------------------------
+    /// Back to the compiled in tables
+    void detach()
+    {
+        _therm_table = B::_therm_table;
+        _hs1101_table = B::_hs1101_table;
+    }
+    //----------------------------------------------------------
+#ifndef ARDUINO
+    /**
+        Add a profile in this data class's shape.
+        @param therm    _therm_table_size values; null for the compiled in table
+        @param humid    sizeT x sizeH values, row major; null for the compiled in table
+     */
+    static void write(CalImageWriter& w, uint32_t sensorId,
+                      const int16_t* therm = nullptr, const int16_t* humid = nullptr)
+    {
+        w.addProfile(sensorId);
+        w.addTable(CalRole::Thermistor, B::_therm_table_scale, thermAxis(), B::_therm_table_size,
+            therm ? therm : B::_therm_table);
+        w.addTable(CalRole::Humidity, B::_humid_table_scale,
+            tempAxis(), B::_humid_table_sizeT, countAxis(), B::_humid_table_sizeH,
+            humid ? humid : &B::_hs1101_table[0][0]);
+    }
+#endif
+    //----------------------------------------------------------
+};
+//-----------------------------------------------
+/// HS1101 logic over HS1101MappedData
+template<typename B>
+class HS1101Mapped : public HS1101< HS1101MappedData<B> >
+{
+};
+
+#endif
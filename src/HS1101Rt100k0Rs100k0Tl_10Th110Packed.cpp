@@ -0,0 +1,394 @@
+/// HS1101 cap>humidity
+
+#include "HS1101Rt100k0Rs100k0Tl_10Th110Packed.h"
+
+
+const int16_t HS1101Rt100k0Rs100k0Tl_10Th110PackedData::_therm_table[_therm_table_size] = 
+{
+   -1671, // [ 0]-13.16°C    128cts 0.413V res=699.2k
+   -1097, // [ 1] -8.65°C    160cts 0.516V res=539.4k
+    -595, // [ 2] -4.69°C    192cts 0.619V res=432.8k
+    -140, // [ 3] -1.11°C    224cts 0.723V res=356.7k
+     279, // [ 4]  2.19°C    256cts 0.826V res=299.6k
+     674, // [ 5]  5.31°C    288cts 0.929V res=255.2k
+    1052, // [ 6]  8.28°C    320cts 1.032V res=219.7k
+    1417, // [ 7] 11.16°C    352cts 1.135V res=190.6k
+    1773, // [ 8] 13.96°C    384cts 1.239V res=166.4k
+    2125, // [ 9] 16.73°C    416cts 1.342V res=145.9k
+    2475, // [10] 19.49°C    448cts 1.445V res=128.3k
+    2826, // [11] 22.25°C    480cts 1.548V res=113.1k
+    3181, // [12] 25.04°C    512cts 1.652V res=99.8k
+    3542, // [13] 27.89°C    544cts 1.755V res=88.1k
+    3914, // [14] 30.82°C    576cts 1.858V res=77.6k
+    4299, // [15] 33.85°C    608cts 1.961V res=68.3k
+    4702, // [16] 37.02°C    640cts 2.065V res=59.8k
+    5127, // [17] 40.37°C    672cts 2.168V res=52.2k
+    5581, // [18] 43.95°C    704cts 2.271V res=45.3k
+    6073, // [19] 47.82°C    736cts 2.374V res=39.0k
+    6612, // [20] 52.06°C    768cts 2.477V res=33.2k
+    7216, // [21] 56.82°C    800cts 2.581V res=27.9k
+    7906, // [22] 62.26°C    832cts 2.684V res=23.0k
+    8721, // [23] 68.67°C    864cts 2.787V res=18.4k
+    9725, // [24] 76.57°C    896cts 2.890V res=14.2k
+   11043, // [25] 86.95°C    928cts 2.994V res=10.2k
+   12975, // [26]102.16°C    960cts 3.097V res=6.6k
+   16590, // [27]130.63°C    992cts 3.200V res=3.1k
+};
+
+const SlopeEntry<int16_t> HS1101Rt100k0Rs100k0Tl_10Th110PackedData::_hs1101_lines[_humid_table_sizeH] =
+{
+  {  30510,   -162 }, // [0]
+  {  29667,   -168 }, // [1]
+  {  28805,   -175 }, // [2]
+  {  27921,   -183 }, // [3]
+  {  27006,   -191 }, // [4]
+  {  26070,   -201 }, // [5]
+  {  25092,   -210 }, // [6]
+  {  24085,   -221 }, // [7]
+  {  23040,   -233 }, // [8]
+  {  21950,   -245 }, // [9]
+  {  20815,   -258 }, // [10]
+  {  19636,   -272 }, // [11]
+  {  18404,   -285 }, // [12]
+  {  17117,   -297 }, // [13]
+  {  15787,   -308 }, // [14]
+  {  14409,   -316 }, // [15]
+  {  12995,   -320 }, // [16]
+  {  11562,   -320 }, // [17]
+  {  10128,   -316 }, // [18]
+  {   8709,   -308 }, // [19]
+  {   7332,   -298 }, // [20]
+  {   5998,   -285 }, // [21]
+  {   4727,   -271 }, // [22]
+  {   3525,   -257 }, // [23]
+};
+
+const int8_t HS1101Rt100k0Rs100k0Tl_10Th110PackedData::_hs1101_resid[_humid_table_sizeT][_humid_table_sizeH] =
+{
+  {
+      -7, // [0,0] 119.15RH%  8500cts 211.76pF @-10.00°C
+      -5, // [0,1] 115.87RH%  8600cts 209.30pF @-10.00°C
+      -6, // [0,2] 112.49RH%  8700cts 206.90pF @-10.00°C
+     -10, // [0,3] 109.03RH%  8800cts 204.55pF @-10.00°C
+      -8, // [0,4] 105.46RH%  8900cts 202.25pF @-10.00°C
+     -15, // [0,5] 101.78RH%  9000cts 200.00pF @-10.00°C
+     -12, // [0,6]  97.97RH%  9100cts 197.80pF @-10.00°C
+     -15, // [0,7]  94.03RH%  9200cts 195.65pF @-10.00°C
+     -18, // [0,8]  89.93RH%  9300cts 193.55pF @-10.00°C
+     -18, // [0,9]  85.67RH%  9400cts 191.49pF @-10.00°C
+     -17, // [0,10]  81.24RH%  9500cts 189.47pF @-10.00°C
+     -21, // [0,11]  76.62RH%  9600cts 187.50pF @-10.00°C
+     -20, // [0,12]  71.81RH%  9700cts 185.57pF @-10.00°C
+     -15, // [0,13]  66.81RH%  9800cts 183.67pF @-10.00°C
+     -13, // [0,14]  61.62RH%  9900cts 181.82pF @-10.00°C
+      -7, // [0,15]  56.26RH% 10000cts 180.00pF @-10.00°C
+       3, // [0,16]  50.77RH% 10100cts 178.22pF @-10.00°C
+      12, // [0,17]  45.21RH% 10200cts 176.47pF @-10.00°C
+      19, // [0,18]  39.64RH% 10300cts 174.76pF @-10.00°C
+      27, // [0,19]  34.13RH% 10400cts 173.08pF @-10.00°C
+      27, // [0,20]  28.75RH% 10500cts 171.43pF @-10.00°C
+      33, // [0,21]  23.56RH% 10600cts 169.81pF @-10.00°C
+      36, // [0,22]  18.60RH% 10700cts 168.22pF @-10.00°C
+      36, // [0,23]  13.91RH% 10800cts 166.67pF @-10.00°C
+  },  {
+      -3, // [1,0] 118.54RH%  8500cts 211.76pF @  0.00°C
+      -1, // [1,1] 115.23RH%  8600cts 209.30pF @  0.00°C
+      -1, // [1,2] 111.83RH%  8700cts 206.90pF @  0.00°C
+      -3, // [1,3] 108.34RH%  8800cts 204.55pF @  0.00°C
+      -2, // [1,4] 104.74RH%  8900cts 202.25pF @  0.00°C
+      -7, // [1,5] 101.02RH%  9000cts 200.00pF @  0.00°C
+      -3, // [1,6]  97.18RH%  9100cts 197.80pF @  0.00°C
+      -5, // [1,7]  93.20RH%  9200cts 195.65pF @  0.00°C
+      -7, // [1,8]  89.06RH%  9300cts 193.55pF @  0.00°C
+      -6, // [1,9]  84.76RH%  9400cts 191.49pF @  0.00°C
+      -6, // [1,10]  80.28RH%  9500cts 189.47pF @  0.00°C
+      -8, // [1,11]  75.61RH%  9600cts 187.50pF @  0.00°C
+      -8, // [1,12]  70.75RH%  9700cts 185.57pF @  0.00°C
+      -4, // [1,13]  65.69RH%  9800cts 183.67pF @  0.00°C
+      -4, // [1,14]  60.45RH%  9900cts 181.82pF @  0.00°C
+      -1, // [1,15]  55.05RH% 10000cts 180.00pF @  0.00°C
+       4, // [1,16]  49.53RH% 10100cts 178.22pF @  0.00°C
+       8, // [1,17]  43.94RH% 10200cts 176.47pF @  0.00°C
+      10, // [1,18]  38.37RH% 10300cts 174.76pF @  0.00°C
+      13, // [1,19]  32.87RH% 10400cts 173.08pF @  0.00°C
+      10, // [1,20]  27.51RH% 10500cts 171.43pF @  0.00°C
+      13, // [1,21]  22.37RH% 10600cts 169.81pF @  0.00°C
+      14, // [1,22]  17.46RH% 10700cts 168.22pF @  0.00°C
+      14, // [1,23]  12.82RH% 10800cts 166.67pF @  0.00°C
+  },  {
+       1, // [2,0] 117.92RH%  8500cts 211.76pF @ 10.00°C
+       3, // [2,1] 114.59RH%  8600cts 209.30pF @ 10.00°C
+       3, // [2,2] 111.16RH%  8700cts 206.90pF @ 10.00°C
+       2, // [2,3] 107.64RH%  8800cts 204.55pF @ 10.00°C
+       4, // [2,4] 104.01RH%  8900cts 202.25pF @ 10.00°C
+       0, // [2,5] 100.27RH%  9000cts 200.00pF @ 10.00°C
+       3, // [2,6]  96.39RH%  9100cts 197.80pF @ 10.00°C
+       3, // [2,7]  92.37RH%  9200cts 195.65pF @ 10.00°C
+       2, // [2,8]  88.19RH%  9300cts 193.55pF @ 10.00°C
+       3, // [2,9]  83.84RH%  9400cts 191.49pF @ 10.00°C
+       4, // [2,10]  79.31RH%  9500cts 189.47pF @ 10.00°C
+       3, // [2,11]  74.59RH%  9600cts 187.50pF @ 10.00°C
+       2, // [2,12]  69.67RH%  9700cts 185.57pF @ 10.00°C
+       5, // [2,13]  64.56RH%  9800cts 183.67pF @ 10.00°C
+       3, // [2,14]  59.27RH%  9900cts 181.82pF @ 10.00°C
+       3, // [2,15]  53.83RH% 10000cts 180.00pF @ 10.00°C
+       4, // [2,16]  48.28RH% 10100cts 178.22pF @ 10.00°C
+       3, // [2,17]  42.68RH% 10200cts 176.47pF @ 10.00°C
+       1, // [2,18]  37.10RH% 10300cts 174.76pF @ 10.00°C
+       0, // [2,19]  31.61RH% 10400cts 173.08pF @ 10.00°C
+      -5, // [2,20]  26.29RH% 10500cts 171.43pF @ 10.00°C
+      -4, // [2,21]  21.19RH% 10600cts 169.81pF @ 10.00°C
+      -4, // [2,22]  16.33RH% 10700cts 168.22pF @ 10.00°C
+      -4, // [2,23]  11.75RH% 10800cts 166.67pF @ 10.00°C
+  },  {
+       4, // [3,0] 117.30RH%  8500cts 211.76pF @ 20.00°C
+       6, // [3,1] 113.94RH%  8600cts 209.30pF @ 20.00°C
+       6, // [3,2] 110.49RH%  8700cts 206.90pF @ 20.00°C
+       6, // [3,3] 106.94RH%  8800cts 204.55pF @ 20.00°C
+       8, // [3,4] 103.28RH%  8900cts 202.25pF @ 20.00°C
+       6, // [3,5]  99.50RH%  9000cts 200.00pF @ 20.00°C
+       9, // [3,6]  95.59RH%  9100cts 197.80pF @ 20.00°C
+       9, // [3,7]  91.53RH%  9200cts 195.65pF @ 20.00°C
+       9, // [3,8]  87.30RH%  9300cts 193.55pF @ 20.00°C
+      10, // [3,9]  82.91RH%  9400cts 191.49pF @ 20.00°C
+      12, // [3,10]  78.33RH%  9500cts 189.47pF @ 20.00°C
+      11, // [3,11]  73.56RH%  9600cts 187.50pF @ 20.00°C
+      10, // [3,12]  68.59RH%  9700cts 185.57pF @ 20.00°C
+      11, // [3,13]  63.43RH%  9800cts 183.67pF @ 20.00°C
+       8, // [3,14]  58.09RH%  9900cts 181.82pF @ 20.00°C
+       6, // [3,15]  52.61RH% 10000cts 180.00pF @ 20.00°C
+       3, // [3,16]  47.02RH% 10100cts 178.22pF @ 20.00°C
+      -1, // [3,17]  41.41RH% 10200cts 176.47pF @ 20.00°C
+      -7, // [3,18]  35.83RH% 10300cts 174.76pF @ 20.00°C
+     -10, // [3,19]  30.37RH% 10400cts 173.08pF @ 20.00°C
+     -16, // [3,20]  25.08RH% 10500cts 171.43pF @ 20.00°C
+     -17, // [3,21]  20.02RH% 10600cts 169.81pF @ 20.00°C
+     -17, // [3,22]  15.22RH% 10700cts 168.22pF @ 20.00°C
+     -18, // [3,23]  10.69RH% 10800cts 166.67pF @ 20.00°C
+  },  {
+       6, // [4,0] 116.67RH%  8500cts 211.76pF @ 30.00°C
+       8, // [4,1] 113.29RH%  8600cts 209.30pF @ 30.00°C
+       8, // [4,2] 109.82RH%  8700cts 206.90pF @ 30.00°C
+       9, // [4,3] 106.24RH%  8800cts 204.55pF @ 30.00°C
+      11, // [4,4] 102.55RH%  8900cts 202.25pF @ 30.00°C
+      10, // [4,5]  98.74RH%  9000cts 200.00pF @ 30.00°C
+      12, // [4,6]  94.78RH%  9100cts 197.80pF @ 30.00°C
+      13, // [4,7]  90.68RH%  9200cts 195.65pF @ 30.00°C
+      14, // [4,8]  86.42RH%  9300cts 193.55pF @ 30.00°C
+      15, // [4,9]  81.97RH%  9400cts 191.49pF @ 30.00°C
+      17, // [4,10]  77.34RH%  9500cts 189.47pF @ 30.00°C
+      17, // [4,11]  72.52RH%  9600cts 187.50pF @ 30.00°C
+      15, // [4,12]  67.50RH%  9700cts 185.57pF @ 30.00°C
+      16, // [4,13]  62.28RH%  9800cts 183.67pF @ 30.00°C
+      11, // [4,14]  56.90RH%  9900cts 181.82pF @ 30.00°C
+       8, // [4,15]  51.38RH% 10000cts 180.00pF @ 30.00°C
+       2, // [4,16]  45.77RH% 10100cts 178.22pF @ 30.00°C
+      -5, // [4,17]  40.15RH% 10200cts 176.47pF @ 30.00°C
+     -12, // [4,18]  34.58RH% 10300cts 174.76pF @ 30.00°C
+     -18, // [4,19]  29.14RH% 10400cts 173.08pF @ 30.00°C
+     -25, // [4,20]  23.89RH% 10500cts 171.43pF @ 30.00°C
+     -26, // [4,21]  18.87RH% 10600cts 169.81pF @ 30.00°C
+     -27, // [4,22]  14.12RH% 10700cts 168.22pF @ 30.00°C
+     -28, // [4,23]   9.65RH% 10800cts 166.67pF @ 30.00°C
+  },  {
+       7, // [5,0] 116.04RH%  8500cts 211.76pF @ 40.00°C
+       9, // [5,1] 112.64RH%  8600cts 209.30pF @ 40.00°C
+      10, // [5,2] 109.14RH%  8700cts 206.90pF @ 40.00°C
+      10, // [5,3] 105.53RH%  8800cts 204.55pF @ 40.00°C
+      13, // [5,4] 101.81RH%  8900cts 202.25pF @ 40.00°C
+      13, // [5,5]  97.96RH%  9000cts 200.00pF @ 40.00°C
+      15, // [5,6]  93.97RH%  9100cts 197.80pF @ 40.00°C
+      16, // [5,7]  89.83RH%  9200cts 195.65pF @ 40.00°C
+      18, // [5,8]  85.52RH%  9300cts 193.55pF @ 40.00°C
+      18, // [5,9]  81.03RH%  9400cts 191.49pF @ 40.00°C
+      20, // [5,10]  76.35RH%  9500cts 189.47pF @ 40.00°C
+      21, // [5,11]  71.47RH%  9600cts 187.50pF @ 40.00°C
+      19, // [5,12]  66.40RH%  9700cts 185.57pF @ 40.00°C
+      18, // [5,13]  61.13RH%  9800cts 183.67pF @ 40.00°C
+      13, // [5,14]  55.70RH%  9900cts 181.82pF @ 40.00°C
+       8, // [5,15]  50.14RH% 10000cts 180.00pF @ 40.00°C
+       1, // [5,16]  44.52RH% 10100cts 178.22pF @ 40.00°C
+      -8, // [5,17]  38.88RH% 10200cts 176.47pF @ 40.00°C
+     -17, // [5,18]  33.33RH% 10300cts 174.76pF @ 40.00°C
+     -23, // [5,19]  27.91RH% 10400cts 173.08pF @ 40.00°C
+     -30, // [5,20]  22.70RH% 10500cts 171.43pF @ 40.00°C
+     -32, // [5,21]  17.74RH% 10600cts 169.81pF @ 40.00°C
+     -33, // [5,22]  13.04RH% 10700cts 168.22pF @ 40.00°C
+     -34, // [5,23]   8.62RH% 10800cts 166.67pF @ 40.00°C
+  },  {
+       8, // [6,0] 115.41RH%  8500cts 211.76pF @ 50.00°C
+       9, // [6,1] 111.98RH%  8600cts 209.30pF @ 50.00°C
+      10, // [6,2] 108.46RH%  8700cts 206.90pF @ 50.00°C
+      11, // [6,3] 104.82RH%  8800cts 204.55pF @ 50.00°C
+      13, // [6,4] 101.07RH%  8900cts 202.25pF @ 50.00°C
+      15, // [6,5]  97.18RH%  9000cts 200.00pF @ 50.00°C
+      15, // [6,6]  93.15RH%  9100cts 197.80pF @ 50.00°C
+      17, // [6,7]  88.97RH%  9200cts 195.65pF @ 50.00°C
+      19, // [6,8]  84.61RH%  9300cts 193.55pF @ 50.00°C
+      19, // [6,9]  80.08RH%  9400cts 191.49pF @ 50.00°C
+      21, // [6,10]  75.34RH%  9500cts 189.47pF @ 50.00°C
+      22, // [6,11]  70.42RH%  9600cts 187.50pF @ 50.00°C
+      20, // [6,12]  65.29RH%  9700cts 185.57pF @ 50.00°C
+      18, // [6,13]  59.97RH%  9800cts 183.67pF @ 50.00°C
+      13, // [6,14]  54.50RH%  9900cts 181.82pF @ 50.00°C
+       8, // [6,15]  48.91RH% 10000cts 180.00pF @ 50.00°C
+       0, // [6,16]  43.26RH% 10100cts 178.22pF @ 50.00°C
+     -10, // [6,17]  37.63RH% 10200cts 176.47pF @ 50.00°C
+     -19, // [6,18]  32.08RH% 10300cts 174.76pF @ 50.00°C
+     -26, // [6,19]  26.70RH% 10400cts 173.08pF @ 50.00°C
+     -32, // [6,20]  21.53RH% 10500cts 171.43pF @ 50.00°C
+     -34, // [6,21]  16.62RH% 10600cts 169.81pF @ 50.00°C
+     -36, // [6,22]  11.97RH% 10700cts 168.22pF @ 50.00°C
+     -36, // [6,23]   7.61RH% 10800cts 166.67pF @ 50.00°C
+  },  {
+       8, // [7,0] 114.78RH%  8500cts 211.76pF @ 60.00°C
+       8, // [7,1] 111.32RH%  8600cts 209.30pF @ 60.00°C
+       9, // [7,2] 107.77RH%  8700cts 206.90pF @ 60.00°C
+      11, // [7,3] 104.10RH%  8800cts 204.55pF @ 60.00°C
+      12, // [7,4] 100.32RH%  8900cts 202.25pF @ 60.00°C
+      15, // [7,5]  96.40RH%  9000cts 200.00pF @ 60.00°C
+      14, // [7,6]  92.33RH%  9100cts 197.80pF @ 60.00°C
+      16, // [7,7]  88.10RH%  9200cts 195.65pF @ 60.00°C
+      18, // [7,8]  83.70RH%  9300cts 193.55pF @ 60.00°C
+      18, // [7,9]  79.11RH%  9400cts 191.49pF @ 60.00°C
+      20, // [7,10]  74.33RH%  9500cts 189.47pF @ 60.00°C
+      21, // [7,11]  69.35RH%  9600cts 187.50pF @ 60.00°C
+      18, // [7,12]  64.17RH%  9700cts 185.57pF @ 60.00°C
+      17, // [7,13]  58.81RH%  9800cts 183.67pF @ 60.00°C
+      12, // [7,14]  53.29RH%  9900cts 181.82pF @ 60.00°C
+       6, // [7,15]  47.67RH% 10000cts 180.00pF @ 60.00°C
+      -2, // [7,16]  42.01RH% 10100cts 178.22pF @ 60.00°C
+     -11, // [7,17]  36.37RH% 10200cts 176.47pF @ 60.00°C
+     -19, // [7,18]  30.85RH% 10300cts 174.76pF @ 60.00°C
+     -26, // [7,19]  25.50RH% 10400cts 173.08pF @ 60.00°C
+     -30, // [7,20]  20.37RH% 10500cts 171.43pF @ 60.00°C
+     -32, // [7,21]  15.51RH% 10600cts 169.81pF @ 60.00°C
+     -34, // [7,22]  10.92RH% 10700cts 168.22pF @ 60.00°C
+     -34, // [7,23]   6.61RH% 10800cts 166.67pF @ 60.00°C
+  },  {
+       7, // [8,0] 114.14RH%  8500cts 211.76pF @ 70.00°C
+       7, // [8,1] 110.66RH%  8600cts 209.30pF @ 70.00°C
+       7, // [8,2] 107.08RH%  8700cts 206.90pF @ 70.00°C
+       9, // [8,3] 103.38RH%  8800cts 204.55pF @ 70.00°C
+      10, // [8,4]  99.56RH%  8900cts 202.25pF @ 70.00°C
+      13, // [8,5]  95.61RH%  9000cts 200.00pF @ 70.00°C
+      12, // [8,6]  91.50RH%  9100cts 197.80pF @ 70.00°C
+      14, // [8,7]  87.23RH%  9200cts 195.65pF @ 70.00°C
+      16, // [8,8]  82.78RH%  9300cts 193.55pF @ 70.00°C
+      15, // [8,9]  78.14RH%  9400cts 191.49pF @ 70.00°C
+      17, // [8,10]  73.31RH%  9500cts 189.47pF @ 70.00°C
+      18, // [8,11]  68.28RH%  9600cts 187.50pF @ 70.00°C
+      15, // [8,12]  63.04RH%  9700cts 185.57pF @ 70.00°C
+      13, // [8,13]  57.63RH%  9800cts 183.67pF @ 70.00°C
+       9, // [8,14]  52.08RH%  9900cts 181.82pF @ 70.00°C
+       5, // [8,15]  46.43RH% 10000cts 180.00pF @ 70.00°C
+      -2, // [8,16]  40.75RH% 10100cts 178.22pF @ 70.00°C
+     -10, // [8,17]  35.13RH% 10200cts 176.47pF @ 70.00°C
+     -17, // [8,18]  29.62RH% 10300cts 174.76pF @ 70.00°C
+     -22, // [8,19]  24.31RH% 10400cts 173.08pF @ 70.00°C
+     -25, // [8,20]  19.23RH% 10500cts 171.43pF @ 70.00°C
+     -27, // [8,21]  14.42RH% 10600cts 169.81pF @ 70.00°C
+     -28, // [8,22]   9.89RH% 10700cts 168.22pF @ 70.00°C
+     -28, // [8,23]   5.63RH% 10800cts 166.67pF @ 70.00°C
+  },  {
+       5, // [9,0] 113.50RH%  8500cts 211.76pF @ 80.00°C
+       4, // [9,1] 110.00RH%  8600cts 209.30pF @ 80.00°C
+       5, // [9,2] 106.38RH%  8700cts 206.90pF @ 80.00°C
+       6, // [9,3] 102.66RH%  8800cts 204.55pF @ 80.00°C
+       7, // [9,4]  98.80RH%  8900cts 202.25pF @ 80.00°C
+      10, // [9,5]  94.81RH%  9000cts 200.00pF @ 80.00°C
+       8, // [9,6]  90.66RH%  9100cts 197.80pF @ 80.00°C
+       9, // [9,7]  86.35RH%  9200cts 195.65pF @ 80.00°C
+      11, // [9,8]  81.85RH%  9300cts 193.55pF @ 80.00°C
+      10, // [9,9]  77.17RH%  9400cts 191.49pF @ 80.00°C
+      11, // [9,10]  72.28RH%  9500cts 189.47pF @ 80.00°C
+      13, // [9,11]  67.19RH%  9600cts 187.50pF @ 80.00°C
+      10, // [9,12]  61.91RH%  9700cts 185.57pF @ 80.00°C
+       8, // [9,13]  56.45RH%  9800cts 183.67pF @ 80.00°C
+       5, // [9,14]  50.86RH%  9900cts 181.82pF @ 80.00°C
+       3, // [9,15]  45.19RH% 10000cts 180.00pF @ 80.00°C
+      -3, // [9,16]  39.50RH% 10100cts 178.22pF @ 80.00°C
+      -8, // [9,17]  33.88RH% 10200cts 176.47pF @ 80.00°C
+     -12, // [9,18]  28.41RH% 10300cts 174.76pF @ 80.00°C
+     -16, // [9,19]  23.13RH% 10400cts 173.08pF @ 80.00°C
+     -16, // [9,20]  18.10RH% 10500cts 171.43pF @ 80.00°C
+     -17, // [9,21]  13.34RH% 10600cts 169.81pF @ 80.00°C
+     -19, // [9,22]   8.86RH% 10700cts 168.22pF @ 80.00°C
+     -18, // [9,23]   4.66RH% 10800cts 166.67pF @ 80.00°C
+  },  {
+       2, // [10,0] 112.86RH%  8500cts 211.76pF @ 90.00°C
+       1, // [10,1] 109.33RH%  8600cts 209.30pF @ 90.00°C
+       1, // [10,2] 105.69RH%  8700cts 206.90pF @ 90.00°C
+       3, // [10,3] 101.93RH%  8800cts 204.55pF @ 90.00°C
+       2, // [10,4]  98.04RH%  8900cts 202.25pF @ 90.00°C
+       6, // [10,5]  94.01RH%  9000cts 200.00pF @ 90.00°C
+       2, // [10,6]  89.82RH%  9100cts 197.80pF @ 90.00°C
+       3, // [10,7]  85.46RH%  9200cts 195.65pF @ 90.00°C
+       5, // [10,8]  80.92RH%  9300cts 193.55pF @ 90.00°C
+       2, // [10,9]  76.18RH%  9400cts 191.49pF @ 90.00°C
+       3, // [10,10]  71.24RH%  9500cts 189.47pF @ 90.00°C
+       6, // [10,11]  66.10RH%  9600cts 187.50pF @ 90.00°C
+       2, // [10,12]  60.77RH%  9700cts 185.57pF @ 90.00°C
+       1, // [10,13]  55.27RH%  9800cts 183.67pF @ 90.00°C
+       0, // [10,14]  49.64RH%  9900cts 181.82pF @ 90.00°C
+       1, // [10,15]  43.94RH% 10000cts 180.00pF @ 90.00°C
+      -2, // [10,16]  38.25RH% 10100cts 178.22pF @ 90.00°C
+      -4, // [10,17]  32.65RH% 10200cts 176.47pF @ 90.00°C
+      -5, // [10,18]  27.20RH% 10300cts 174.76pF @ 90.00°C
+      -6, // [10,19]  21.97RH% 10400cts 173.08pF @ 90.00°C
+      -4, // [10,20]  16.99RH% 10500cts 171.43pF @ 90.00°C
+      -4, // [10,21]  12.28RH% 10600cts 169.81pF @ 90.00°C
+      -5, // [10,22]   7.86RH% 10700cts 168.22pF @ 90.00°C
+      -5, // [10,23]   3.71RH% 10800cts 166.67pF @ 90.00°C
+  },  {
+      -2, // [11,0] 112.21RH%  8500cts 211.76pF @100.00°C
+      -4, // [11,1] 108.65RH%  8600cts 209.30pF @100.00°C
+      -4, // [11,2] 104.98RH%  8700cts 206.90pF @100.00°C
+      -3, // [11,3] 101.19RH%  8800cts 204.55pF @100.00°C
+      -4, // [11,4]  97.27RH%  8900cts 202.25pF @100.00°C
+       0, // [11,5]  93.20RH%  9000cts 200.00pF @100.00°C
+      -6, // [11,6]  88.97RH%  9100cts 197.80pF @100.00°C
+      -5, // [11,7]  84.56RH%  9200cts 195.65pF @100.00°C
+      -4, // [11,8]  79.97RH%  9300cts 193.55pF @100.00°C
+      -8, // [11,9]  75.19RH%  9400cts 191.49pF @100.00°C
+      -7, // [11,10]  70.19RH%  9500cts 189.47pF @100.00°C
+      -4, // [11,11]  65.00RH%  9600cts 187.50pF @100.00°C
+      -7, // [11,12]  59.62RH%  9700cts 185.57pF @100.00°C
+      -7, // [11,13]  54.07RH%  9800cts 183.67pF @100.00°C
+      -5, // [11,14]  48.41RH%  9900cts 181.82pF @100.00°C
+      -2, // [11,15]  42.70RH% 10000cts 180.00pF @100.00°C
+       0, // [11,16]  37.01RH% 10100cts 178.22pF @100.00°C
+       2, // [11,17]  31.42RH% 10200cts 176.47pF @100.00°C
+       5, // [11,18]  26.00RH% 10300cts 174.76pF @100.00°C
+       7, // [11,19]  20.81RH% 10400cts 173.08pF @100.00°C
+      12, // [11,20]  15.88RH% 10500cts 171.43pF @100.00°C
+      13, // [11,21]  11.24RH% 10600cts 169.81pF @100.00°C
+      12, // [11,22]   6.87RH% 10700cts 168.22pF @100.00°C
+      12, // [11,23]   2.77RH% 10800cts 166.67pF @100.00°C
+  },  {
+      -6, // [12,0] 111.56RH%  8500cts 211.76pF @110.00°C
+      -9, // [12,1] 107.98RH%  8600cts 209.30pF @110.00°C
+     -10, // [12,2] 104.28RH%  8700cts 206.90pF @110.00°C
+      -9, // [12,3] 100.45RH%  8800cts 204.55pF @110.00°C
+     -12, // [12,4]  96.49RH%  8900cts 202.25pF @110.00°C
+      -8, // [12,5]  92.38RH%  9000cts 200.00pF @110.00°C
+     -15, // [12,6]  88.11RH%  9100cts 197.80pF @110.00°C
+     -16, // [12,7]  83.66RH%  9200cts 195.65pF @110.00°C
+     -14, // [12,8]  79.02RH%  9300cts 193.55pF @110.00°C
+     -19, // [12,9]  74.18RH%  9400cts 191.49pF @110.00°C
+     -20, // [12,10]  69.14RH%  9500cts 189.47pF @110.00°C
+     -16, // [12,11]  63.89RH%  9600cts 187.50pF @110.00°C
+     -18, // [12,12]  58.46RH%  9700cts 185.57pF @110.00°C
+     -17, // [12,13]  52.88RH%  9800cts 183.67pF @110.00°C
+     -11, // [12,14]  47.19RH%  9900cts 181.82pF @110.00°C
+      -3, // [12,15]  41.46RH% 10000cts 180.00pF @110.00°C
+       3, // [12,16]  35.77RH% 10100cts 178.22pF @110.00°C
+      10, // [12,17]  30.20RH% 10200cts 176.47pF @110.00°C
+      18, // [12,18]  24.82RH% 10300cts 174.76pF @110.00°C
+      24, // [12,19]  19.68RH% 10400cts 173.08pF @110.00°C
+      32, // [12,20]  14.80RH% 10500cts 171.43pF @110.00°C
+      34, // [12,21]  10.20RH% 10600cts 169.81pF @110.00°C
+      33, // [12,22]   5.89RH% 10700cts 168.22pF @110.00°C
+      33, // [12,23]   1.85RH% 10800cts 166.67pF @110.00°C
+  },
+};
@@ -0,0 +1,379 @@
+/// HS1101 cap>humidity
+
+#include "HS1101Rt100k0Rs100k0Tl_10Th110Ro40k3W32.h"
+
+
+const int16_t HS1101Rt100k0Rs100k0Tl_10Th110Ro40k3W32Data::_therm_table[_therm_table_size] = 
+{
+   -1671, // [ 0]-13.16°C    128cts 0.413V res=699.2k
+   -1097, // [ 1] -8.65°C    160cts 0.516V res=539.4k
+    -595, // [ 2] -4.69°C    192cts 0.619V res=432.8k
+    -140, // [ 3] -1.11°C    224cts 0.723V res=356.7k
+     279, // [ 4]  2.19°C    256cts 0.826V res=299.6k
+     674, // [ 5]  5.31°C    288cts 0.929V res=255.2k
+    1052, // [ 6]  8.28°C    320cts 1.032V res=219.7k
+    1417, // [ 7] 11.16°C    352cts 1.135V res=190.6k
+    1773, // [ 8] 13.96°C    384cts 1.239V res=166.4k
+    2125, // [ 9] 16.73°C    416cts 1.342V res=145.9k
+    2475, // [10] 19.49°C    448cts 1.445V res=128.3k
+    2826, // [11] 22.25°C    480cts 1.548V res=113.1k
+    3181, // [12] 25.04°C    512cts 1.652V res=99.8k
+    3542, // [13] 27.89°C    544cts 1.755V res=88.1k
+    3914, // [14] 30.82°C    576cts 1.858V res=77.6k
+    4299, // [15] 33.85°C    608cts 1.961V res=68.3k
+    4702, // [16] 37.02°C    640cts 2.065V res=59.8k
+    5127, // [17] 40.37°C    672cts 2.168V res=52.2k
+    5581, // [18] 43.95°C    704cts 2.271V res=45.3k
+    6073, // [19] 47.82°C    736cts 2.374V res=39.0k
+    6612, // [20] 52.06°C    768cts 2.477V res=33.2k
+    7216, // [21] 56.82°C    800cts 2.581V res=27.9k
+    7906, // [22] 62.26°C    832cts 2.684V res=23.0k
+    8721, // [23] 68.67°C    864cts 2.787V res=18.4k
+    9725, // [24] 76.57°C    896cts 2.890V res=14.2k
+   11043, // [25] 86.95°C    928cts 2.994V res=10.2k
+   12975, // [26]102.16°C    960cts 3.097V res=6.6k
+   16590, // [27]130.63°C    992cts 3.200V res=3.1k
+};
+
+const int16_t HS1101Rt100k0Rs100k0Tl_10Th110Ro40k3W32Data::_hs1101_table[_humid_table_sizeT][_humid_table_sizeH] = 
+{
+  {
+     27911, // [0,0] 109.03RH% 88000cts 20.45pF @-10.00°C
+     26998, // [0,1] 105.46RH% 89000cts 20.22pF @-10.00°C
+     26055, // [0,2] 101.78RH% 90000cts 20.00pF @-10.00°C
+     25080, // [0,3]  97.97RH% 91000cts 19.78pF @-10.00°C
+     24070, // [0,4]  94.03RH% 92000cts 19.57pF @-10.00°C
+     23022, // [0,5]  89.93RH% 93000cts 19.35pF @-10.00°C
+     21932, // [0,6]  85.67RH% 94000cts 19.15pF @-10.00°C
+     20798, // [0,7]  81.24RH% 95000cts 18.95pF @-10.00°C
+     19615, // [0,8]  76.62RH% 96000cts 18.75pF @-10.00°C
+     18384, // [0,9]  71.81RH% 97000cts 18.56pF @-10.00°C
+     17102, // [0,10]  66.81RH% 98000cts 18.37pF @-10.00°C
+     15774, // [0,11]  61.62RH% 99000cts 18.18pF @-10.00°C
+     14402, // [0,12]  56.26RH% 100000cts 18.00pF @-10.00°C
+     12998, // [0,13]  50.77RH% 101000cts 17.82pF @-10.00°C
+     11574, // [0,14]  45.21RH% 102000cts 17.65pF @-10.00°C
+     10147, // [0,15]  39.64RH% 103000cts 17.48pF @-10.00°C
+      8736, // [0,16]  34.13RH% 104000cts 17.31pF @-10.00°C
+      7359, // [0,17]  28.75RH% 105000cts 17.14pF @-10.00°C
+      6031, // [0,18]  23.56RH% 106000cts 16.98pF @-10.00°C
+      4763, // [0,19]  18.60RH% 107000cts 16.82pF @-10.00°C
+      3561, // [0,20]  13.91RH% 108000cts 16.67pF @-10.00°C
+      2428, // [0,21]   9.48RH% 109000cts 16.51pF @-10.00°C
+      1363, // [0,22]   5.32RH% 110000cts 16.36pF @-10.00°C
+       363, // [0,23]   1.42RH% 111000cts 16.22pF @-10.00°C
+      -573, // [0,24]  -2.24RH% 112000cts 16.07pF @-10.00°C
+  },  {
+     27735, // [1,0] 108.34RH% 88000cts 20.45pF @  0.00°C
+     26813, // [1,1] 104.74RH% 89000cts 20.22pF @  0.00°C
+     25862, // [1,2] 101.02RH% 90000cts 20.00pF @  0.00°C
+     24879, // [1,3]  97.18RH% 91000cts 19.78pF @  0.00°C
+     23859, // [1,4]  93.20RH% 92000cts 19.57pF @  0.00°C
+     22800, // [1,5]  89.06RH% 93000cts 19.35pF @  0.00°C
+     21699, // [1,6]  84.76RH% 94000cts 19.15pF @  0.00°C
+     20551, // [1,7]  80.28RH% 95000cts 18.95pF @  0.00°C
+     19356, // [1,8]  75.61RH% 96000cts 18.75pF @  0.00°C
+     18111, // [1,9]  70.75RH% 97000cts 18.56pF @  0.00°C
+     16816, // [1,10]  65.69RH% 98000cts 18.37pF @  0.00°C
+     15475, // [1,11]  60.45RH% 99000cts 18.18pF @  0.00°C
+     14092, // [1,12]  55.05RH% 100000cts 18.00pF @  0.00°C
+     12679, // [1,13]  49.53RH% 101000cts 17.82pF @  0.00°C
+     11250, // [1,14]  43.94RH% 102000cts 17.65pF @  0.00°C
+      9822, // [1,15]  38.37RH% 103000cts 17.48pF @  0.00°C
+      8414, // [1,16]  32.87RH% 104000cts 17.31pF @  0.00°C
+      7044, // [1,17]  27.51RH% 105000cts 17.14pF @  0.00°C
+      5726, // [1,18]  22.37RH% 106000cts 16.98pF @  0.00°C
+      4470, // [1,19]  17.46RH% 107000cts 16.82pF @  0.00°C
+      3282, // [1,20]  12.82RH% 108000cts 16.67pF @  0.00°C
+      2163, // [1,21]   8.45RH% 109000cts 16.51pF @  0.00°C
+      1112, // [1,22]   4.34RH% 110000cts 16.36pF @  0.00°C
+       126, // [1,23]   0.49RH% 111000cts 16.22pF @  0.00°C
+      -798, // [1,24]  -3.12RH% 112000cts 16.07pF @  0.00°C
+  },  {
+     27557, // [2,0] 107.64RH% 88000cts 20.45pF @ 10.00°C
+     26628, // [2,1] 104.01RH% 89000cts 20.22pF @ 10.00°C
+     25668, // [2,2] 100.27RH% 90000cts 20.00pF @ 10.00°C
+     24675, // [2,3]  96.39RH% 91000cts 19.78pF @ 10.00°C
+     23646, // [2,4]  92.37RH% 92000cts 19.57pF @ 10.00°C
+     22576, // [2,5]  88.19RH% 93000cts 19.35pF @ 10.00°C
+     21463, // [2,6]  83.84RH% 94000cts 19.15pF @ 10.00°C
+     20303, // [2,7]  79.31RH% 95000cts 18.95pF @ 10.00°C
+     19095, // [2,8]  74.59RH% 96000cts 18.75pF @ 10.00°C
+     17836, // [2,9]  69.67RH% 97000cts 18.56pF @ 10.00°C
+     16528, // [2,10]  64.56RH% 98000cts 18.37pF @ 10.00°C
+     15174, // [2,11]  59.27RH% 99000cts 18.18pF @ 10.00°C
+     13780, // [2,12]  53.83RH% 100000cts 18.00pF @ 10.00°C
+     12359, // [2,13]  48.28RH% 101000cts 17.82pF @ 10.00°C
+     10925, // [2,14]  42.68RH% 102000cts 17.65pF @ 10.00°C
+      9497, // [2,15]  37.10RH% 103000cts 17.48pF @ 10.00°C
+      8093, // [2,16]  31.61RH% 104000cts 17.31pF @ 10.00°C
+      6731, // [2,17]  26.29RH% 105000cts 17.14pF @ 10.00°C
+      5424, // [2,18]  21.19RH% 106000cts 16.98pF @ 10.00°C
+      4181, // [2,19]  16.33RH% 107000cts 16.82pF @ 10.00°C
+      3007, // [2,20]  11.75RH% 108000cts 16.67pF @ 10.00°C
+      1902, // [2,21]   7.43RH% 109000cts 16.51pF @ 10.00°C
+       865, // [2,22]   3.38RH% 110000cts 16.36pF @ 10.00°C
+      -107, // [2,23]  -0.42RH% 111000cts 16.22pF @ 10.00°C
+     -1019, // [2,24]  -3.98RH% 112000cts 16.07pF @ 10.00°C
+  },  {
+     27378, // [3,0] 106.94RH% 88000cts 20.45pF @ 20.00°C
+     26441, // [3,1] 103.28RH% 89000cts 20.22pF @ 20.00°C
+     25473, // [3,2]  99.50RH% 90000cts 20.00pF @ 20.00°C
+     24471, // [3,3]  95.59RH% 91000cts 19.78pF @ 20.00°C
+     23431, // [3,4]  91.53RH% 92000cts 19.57pF @ 20.00°C
+     22350, // [3,5]  87.30RH% 93000cts 19.35pF @ 20.00°C
+     21225, // [3,6]  82.91RH% 94000cts 19.15pF @ 20.00°C
+     20053, // [3,7]  78.33RH% 95000cts 18.95pF @ 20.00°C
+     18831, // [3,8]  73.56RH% 96000cts 18.75pF @ 20.00°C
+     17559, // [3,9]  68.59RH% 97000cts 18.56pF @ 20.00°C
+     16237, // [3,10]  63.43RH% 98000cts 18.37pF @ 20.00°C
+     14871, // [3,11]  58.09RH% 99000cts 18.18pF @ 20.00°C
+     13467, // [3,12]  52.61RH% 100000cts 18.00pF @ 20.00°C
+     12038, // [3,13]  47.02RH% 101000cts 17.82pF @ 20.00°C
+     10601, // [3,14]  41.41RH% 102000cts 17.65pF @ 20.00°C
+      9173, // [3,15]  35.83RH% 103000cts 17.48pF @ 20.00°C
+      7775, // [3,16]  30.37RH% 104000cts 17.31pF @ 20.00°C
+      6422, // [3,17]  25.08RH% 105000cts 17.14pF @ 20.00°C
+      5126, // [3,18]  20.02RH% 106000cts 16.98pF @ 20.00°C
+      3897, // [3,19]  15.22RH% 107000cts 16.82pF @ 20.00°C
+      2736, // [3,20]  10.69RH% 108000cts 16.67pF @ 20.00°C
+      1646, // [3,21]   6.43RH% 109000cts 16.51pF @ 20.00°C
+       622, // [3,22]   2.43RH% 110000cts 16.36pF @ 20.00°C
+      -337, // [3,23]  -1.32RH% 111000cts 16.22pF @ 20.00°C
+     -1237, // [3,24]  -4.84RH% 112000cts 16.07pF @ 20.00°C
+  },  {
+     27198, // [4,0] 106.24RH% 88000cts 20.45pF @ 30.00°C
+     26253, // [4,1] 102.55RH% 89000cts 20.22pF @ 30.00°C
+     25276, // [4,2]  98.74RH% 90000cts 20.00pF @ 30.00°C
+     24264, // [4,3]  94.78RH% 91000cts 19.78pF @ 30.00°C
+     23214, // [4,4]  90.68RH% 92000cts 19.57pF @ 30.00°C
+     22122, // [4,5]  86.42RH% 93000cts 19.35pF @ 30.00°C
+     20985, // [4,6]  81.97RH% 94000cts 19.15pF @ 30.00°C
+     19800, // [4,7]  77.34RH% 95000cts 18.95pF @ 30.00°C
+     18565, // [4,8]  72.52RH% 96000cts 18.75pF @ 30.00°C
+     17279, // [4,9]  67.50RH% 97000cts 18.56pF @ 30.00°C
+     15945, // [4,10]  62.28RH% 98000cts 18.37pF @ 30.00°C
+     14566, // [4,11]  56.90RH% 99000cts 18.18pF @ 30.00°C
+     13153, // [4,12]  51.38RH% 100000cts 18.00pF @ 30.00°C
+     11717, // [4,13]  45.77RH% 101000cts 17.82pF @ 30.00°C
+     10277, // [4,14]  40.15RH% 102000cts 17.65pF @ 30.00°C
+      8852, // [4,15]  34.58RH% 103000cts 17.48pF @ 30.00°C
+      7459, // [4,16]  29.14RH% 104000cts 17.31pF @ 30.00°C
+      6115, // [4,17]  23.89RH% 105000cts 17.14pF @ 30.00°C
+      4832, // [4,18]  18.87RH% 106000cts 16.98pF @ 30.00°C
+      3616, // [4,19]  14.12RH% 107000cts 16.82pF @ 30.00°C
+      2469, // [4,20]   9.65RH% 108000cts 16.67pF @ 30.00°C
+      1393, // [4,21]   5.44RH% 109000cts 16.51pF @ 30.00°C
+       383, // [4,22]   1.50RH% 110000cts 16.36pF @ 30.00°C
+      -563, // [4,23]  -2.20RH% 111000cts 16.22pF @ 30.00°C
+     -1451, // [4,24]  -5.67RH% 112000cts 16.07pF @ 30.00°C
+  },  {
+     27016, // [5,0] 105.53RH% 88000cts 20.45pF @ 40.00°C
+     26064, // [5,1] 101.81RH% 89000cts 20.22pF @ 40.00°C
+     25078, // [5,2]  97.96RH% 90000cts 20.00pF @ 40.00°C
+     24057, // [5,3]  93.97RH% 91000cts 19.78pF @ 40.00°C
+     22996, // [5,4]  89.83RH% 92000cts 19.57pF @ 40.00°C
+     21893, // [5,5]  85.52RH% 93000cts 19.35pF @ 40.00°C
+     20743, // [5,6]  81.03RH% 94000cts 19.15pF @ 40.00°C
+     19545, // [5,7]  76.35RH% 95000cts 18.95pF @ 40.00°C
+     18297, // [5,8]  71.47RH% 96000cts 18.75pF @ 40.00°C
+     16998, // [5,9]  66.40RH% 97000cts 18.56pF @ 40.00°C
+     15650, // [5,10]  61.13RH% 98000cts 18.37pF @ 40.00°C
+     14260, // [5,11]  55.70RH% 99000cts 18.18pF @ 40.00°C
+     12837, // [5,12]  50.14RH% 100000cts 18.00pF @ 40.00°C
+     11396, // [5,13]  44.52RH% 101000cts 17.82pF @ 40.00°C
+      9954, // [5,14]  38.88RH% 102000cts 17.65pF @ 40.00°C
+      8531, // [5,15]  33.33RH% 103000cts 17.48pF @ 40.00°C
+      7146, // [5,16]  27.91RH% 104000cts 17.31pF @ 40.00°C
+      5812, // [5,17]  22.70RH% 105000cts 17.14pF @ 40.00°C
+      4541, // [5,18]  17.74RH% 106000cts 16.98pF @ 40.00°C
+      3339, // [5,19]  13.04RH% 107000cts 16.82pF @ 40.00°C
+      2206, // [5,20]   8.62RH% 108000cts 16.67pF @ 40.00°C
+      1144, // [5,21]   4.47RH% 109000cts 16.51pF @ 40.00°C
+       147, // [5,22]   0.58RH% 110000cts 16.36pF @ 40.00°C
+      -786, // [5,23]  -3.07RH% 111000cts 16.22pF @ 40.00°C
+     -1662, // [5,24]  -6.50RH% 112000cts 16.07pF @ 40.00°C
+  },  {
+     26834, // [6,0] 104.82RH% 88000cts 20.45pF @ 50.00°C
+     25873, // [6,1] 101.07RH% 89000cts 20.22pF @ 50.00°C
+     24879, // [6,2]  97.18RH% 90000cts 20.00pF @ 50.00°C
+     23847, // [6,3]  93.15RH% 91000cts 19.78pF @ 50.00°C
+     22776, // [6,4]  88.97RH% 92000cts 19.57pF @ 50.00°C
+     21661, // [6,5]  84.61RH% 93000cts 19.35pF @ 50.00°C
+     20499, // [6,6]  80.08RH% 94000cts 19.15pF @ 50.00°C
+     19288, // [6,7]  75.34RH% 95000cts 18.95pF @ 50.00°C
+     18026, // [6,8]  70.42RH% 96000cts 18.75pF @ 50.00°C
+     16714, // [6,9]  65.29RH% 97000cts 18.56pF @ 50.00°C
+     15353, // [6,10]  59.97RH% 98000cts 18.37pF @ 50.00°C
+     13952, // [6,11]  54.50RH% 99000cts 18.18pF @ 50.00°C
+     12521, // [6,12]  48.91RH% 100000cts 18.00pF @ 50.00°C
+     11075, // [6,13]  43.26RH% 101000cts 17.82pF @ 50.00°C
+      9632, // [6,14]  37.63RH% 102000cts 17.65pF @ 50.00°C
+      8213, // [6,15]  32.08RH% 103000cts 17.48pF @ 50.00°C
+      6835, // [6,16]  26.70RH% 104000cts 17.31pF @ 50.00°C
+      5512, // [6,17]  21.53RH% 105000cts 17.14pF @ 50.00°C
+      4254, // [6,18]  16.62RH% 106000cts 16.98pF @ 50.00°C
+      3065, // [6,19]  11.97RH% 107000cts 16.82pF @ 50.00°C
+      1947, // [6,20]   7.61RH% 108000cts 16.67pF @ 50.00°C
+       899, // [6,21]   3.51RH% 109000cts 16.51pF @ 50.00°C
+       -84, // [6,22]  -0.33RH% 110000cts 16.36pF @ 50.00°C
+     -1005, // [6,23]  -3.93RH% 111000cts 16.22pF @ 50.00°C
+     -1870, // [6,24]  -7.31RH% 112000cts 16.07pF @ 50.00°C
+  },  {
+     26651, // [7,0] 104.10RH% 88000cts 20.45pF @ 60.00°C
+     25681, // [7,1] 100.32RH% 89000cts 20.22pF @ 60.00°C
+     24678, // [7,2]  96.40RH% 90000cts 20.00pF @ 60.00°C
+     23636, // [7,3]  92.33RH% 91000cts 19.78pF @ 60.00°C
+     22554, // [7,4]  88.10RH% 92000cts 19.57pF @ 60.00°C
+     21427, // [7,5]  83.70RH% 93000cts 19.35pF @ 60.00°C
+     20253, // [7,6]  79.11RH% 94000cts 19.15pF @ 60.00°C
+     19029, // [7,7]  74.33RH% 95000cts 18.95pF @ 60.00°C
+     17753, // [7,8]  69.35RH% 96000cts 18.75pF @ 60.00°C
+     16427, // [7,9]  64.17RH% 97000cts 18.56pF @ 60.00°C
+     15055, // [7,10]  58.81RH% 98000cts 18.37pF @ 60.00°C
+     13643, // [7,11]  53.29RH% 99000cts 18.18pF @ 60.00°C
+     12203, // [7,12]  47.67RH% 100000cts 18.00pF @ 60.00°C
+     10753, // [7,13]  42.01RH% 101000cts 17.82pF @ 60.00°C
+      9311, // [7,14]  36.37RH% 102000cts 17.65pF @ 60.00°C
+      7897, // [7,15]  30.85RH% 103000cts 17.48pF @ 60.00°C
+      6527, // [7,16]  25.50RH% 104000cts 17.31pF @ 60.00°C
+      5216, // [7,17]  20.37RH% 105000cts 17.14pF @ 60.00°C
+      3971, // [7,18]  15.51RH% 106000cts 16.98pF @ 60.00°C
+      2796, // [7,19]  10.92RH% 107000cts 16.82pF @ 60.00°C
+      1692, // [7,20]   6.61RH% 108000cts 16.67pF @ 60.00°C
+       657, // [7,21]   2.57RH% 109000cts 16.51pF @ 60.00°C
+      -312, // [7,22]  -1.22RH% 110000cts 16.36pF @ 60.00°C
+     -1221, // [7,23]  -4.78RH% 111000cts 16.22pF @ 60.00°C
+     -2075, // [7,24]  -8.11RH% 112000cts 16.07pF @ 60.00°C
+  },  {
+     26466, // [8,0] 103.38RH% 88000cts 20.45pF @ 70.00°C
+     25488, // [8,1]  99.56RH% 89000cts 20.22pF @ 70.00°C
+     24475, // [8,2]  95.61RH% 90000cts 20.00pF @ 70.00°C
+     23424, // [8,3]  91.50RH% 91000cts 19.78pF @ 70.00°C
+     22331, // [8,4]  87.23RH% 92000cts 19.57pF @ 70.00°C
+     21192, // [8,5]  82.78RH% 93000cts 19.35pF @ 70.00°C
+     20005, // [8,6]  78.14RH% 94000cts 19.15pF @ 70.00°C
+     18768, // [8,7]  73.31RH% 95000cts 18.95pF @ 70.00°C
+     17478, // [8,8]  68.28RH% 96000cts 18.75pF @ 70.00°C
+     16139, // [8,9]  63.04RH% 97000cts 18.56pF @ 70.00°C
+     14754, // [8,10]  57.63RH% 98000cts 18.37pF @ 70.00°C
+     13332, // [8,11]  52.08RH% 99000cts 18.18pF @ 70.00°C
+     11886, // [8,12]  46.43RH% 100000cts 18.00pF @ 70.00°C
+     10433, // [8,13]  40.75RH% 101000cts 17.82pF @ 70.00°C
+      8992, // [8,14]  35.13RH% 102000cts 17.65pF @ 70.00°C
+      7583, // [8,15]  29.62RH% 103000cts 17.48pF @ 70.00°C
+      6223, // [8,16]  24.31RH% 104000cts 17.31pF @ 70.00°C
+      4923, // [8,17]  19.23RH% 105000cts 17.14pF @ 70.00°C
+      3691, // [8,18]  14.42RH% 106000cts 16.98pF @ 70.00°C
+      2531, // [8,19]   9.89RH% 107000cts 16.82pF @ 70.00°C
+      1441, // [8,20]   5.63RH% 108000cts 16.67pF @ 70.00°C
+       420, // [8,21]   1.64RH% 109000cts 16.51pF @ 70.00°C
+      -537, // [8,22]  -2.10RH% 110000cts 16.36pF @ 70.00°C
+     -1434, // [8,23]  -5.61RH% 111000cts 16.22pF @ 70.00°C
+     -2277, // [8,24]  -8.90RH% 112000cts 16.07pF @ 70.00°C
+  },  {
+     26280, // [9,0] 102.66RH% 88000cts 20.45pF @ 80.00°C
+     25294, // [9,1]  98.80RH% 89000cts 20.22pF @ 80.00°C
+     24271, // [9,2]  94.81RH% 90000cts 20.00pF @ 80.00°C
+     23210, // [9,3]  90.66RH% 91000cts 19.78pF @ 80.00°C
+     22105, // [9,4]  86.35RH% 92000cts 19.57pF @ 80.00°C
+     20954, // [9,5]  81.85RH% 93000cts 19.35pF @ 80.00°C
+     19755, // [9,6]  77.17RH% 94000cts 19.15pF @ 80.00°C
+     18504, // [9,7]  72.28RH% 95000cts 18.95pF @ 80.00°C
+     17201, // [9,8]  67.19RH% 96000cts 18.75pF @ 80.00°C
+     15849, // [9,9]  61.91RH% 97000cts 18.56pF @ 80.00°C
+     14452, // [9,10]  56.45RH% 98000cts 18.37pF @ 80.00°C
+     13020, // [9,11]  50.86RH% 99000cts 18.18pF @ 80.00°C
+     11568, // [9,12]  45.19RH% 100000cts 18.00pF @ 80.00°C
+     10112, // [9,13]  39.50RH% 101000cts 17.82pF @ 80.00°C
+      8674, // [9,14]  33.88RH% 102000cts 17.65pF @ 80.00°C
+      7272, // [9,15]  28.41RH% 103000cts 17.48pF @ 80.00°C
+      5921, // [9,16]  23.13RH% 104000cts 17.31pF @ 80.00°C
+      4634, // [9,17]  18.10RH% 105000cts 17.14pF @ 80.00°C
+      3416, // [9,18]  13.34RH% 106000cts 16.98pF @ 80.00°C
+      2269, // [9,19]   8.86RH% 107000cts 16.82pF @ 80.00°C
+      1194, // [9,20]   4.66RH% 108000cts 16.67pF @ 80.00°C
+       186, // [9,21]   0.72RH% 109000cts 16.51pF @ 80.00°C
+      -758, // [9,22]  -2.96RH% 110000cts 16.36pF @ 80.00°C
+     -1644, // [9,23]  -6.42RH% 111000cts 16.22pF @ 80.00°C
+     -2475, // [9,24]  -9.67RH% 112000cts 16.07pF @ 80.00°C
+  },  {
+     26094, // [10,0] 101.93RH% 88000cts 20.45pF @ 90.00°C
+     25098, // [10,1]  98.04RH% 89000cts 20.22pF @ 90.00°C
+     24066, // [10,2]  94.01RH% 90000cts 20.00pF @ 90.00°C
+     22994, // [10,3]  89.82RH% 91000cts 19.78pF @ 90.00°C
+     21878, // [10,4]  85.46RH% 92000cts 19.57pF @ 90.00°C
+     20715, // [10,5]  80.92RH% 93000cts 19.35pF @ 90.00°C
+     19502, // [10,6]  76.18RH% 94000cts 19.15pF @ 90.00°C
+     18238, // [10,7]  71.24RH% 95000cts 18.95pF @ 90.00°C
+     16922, // [10,8]  66.10RH% 96000cts 18.75pF @ 90.00°C
+     15556, // [10,9]  60.77RH% 97000cts 18.56pF @ 90.00°C
+     14148, // [10,10]  55.27RH% 98000cts 18.37pF @ 90.00°C
+     12707, // [10,11]  49.64RH% 99000cts 18.18pF @ 90.00°C
+     11250, // [10,12]  43.94RH% 100000cts 18.00pF @ 90.00°C
+      9793, // [10,13]  38.25RH% 101000cts 17.82pF @ 90.00°C
+      8358, // [10,14]  32.65RH% 102000cts 17.65pF @ 90.00°C
+      6963, // [10,15]  27.20RH% 103000cts 17.48pF @ 90.00°C
+      5623, // [10,16]  21.97RH% 104000cts 17.31pF @ 90.00°C
+      4348, // [10,17]  16.99RH% 105000cts 17.14pF @ 90.00°C
+      3144, // [10,18]  12.28RH% 106000cts 16.98pF @ 90.00°C
+      2012, // [10,19]   7.86RH% 107000cts 16.82pF @ 90.00°C
+       950, // [10,20]   3.71RH% 108000cts 16.67pF @ 90.00°C
+       -44, // [10,21]  -0.18RH% 109000cts 16.51pF @ 90.00°C
+      -976, // [10,22]  -3.82RH% 110000cts 16.36pF @ 90.00°C
+     -1850, // [10,23]  -7.23RH% 111000cts 16.22pF @ 90.00°C
+     -2671, // [10,24] -10.44RH% 112000cts 16.07pF @ 90.00°C
+  },  {
+     25905, // [11,0] 101.19RH% 88000cts 20.45pF @100.00°C
+     24901, // [11,1]  97.27RH% 89000cts 20.22pF @100.00°C
+     23859, // [11,2]  93.20RH% 90000cts 20.00pF @100.00°C
+     22776, // [11,3]  88.97RH% 91000cts 19.78pF @100.00°C
+     21649, // [11,4]  84.56RH% 92000cts 19.57pF @100.00°C
+     20473, // [11,5]  79.97RH% 93000cts 19.35pF @100.00°C
+     19247, // [11,6]  75.19RH% 94000cts 19.15pF @100.00°C
+     17970, // [11,7]  70.19RH% 95000cts 18.95pF @100.00°C
+     16640, // [11,8]  65.00RH% 96000cts 18.75pF @100.00°C
+     15262, // [11,9]  59.62RH% 97000cts 18.56pF @100.00°C
+     13843, // [11,10]  54.07RH% 98000cts 18.37pF @100.00°C
+     12394, // [11,11]  48.41RH% 99000cts 18.18pF @100.00°C
+     10931, // [11,12]  42.70RH% 100000cts 18.00pF @100.00°C
+      9475, // [11,13]  37.01RH% 101000cts 17.82pF @100.00°C
+      8044, // [11,14]  31.42RH% 102000cts 17.65pF @100.00°C
+      6657, // [11,15]  26.00RH% 103000cts 17.48pF @100.00°C
+      5328, // [11,16]  20.81RH% 104000cts 17.31pF @100.00°C
+      4066, // [11,17]  15.88RH% 105000cts 17.14pF @100.00°C
+      2876, // [11,18]  11.24RH% 106000cts 16.98pF @100.00°C
+      1758, // [11,19]   6.87RH% 107000cts 16.82pF @100.00°C
+       710, // [11,20]   2.77RH% 108000cts 16.67pF @100.00°C
+      -271, // [11,21]  -1.06RH% 109000cts 16.51pF @100.00°C
+     -1191, // [11,22]  -4.65RH% 110000cts 16.36pF @100.00°C
+     -2053, // [11,23]  -8.02RH% 111000cts 16.22pF @100.00°C
+     -2864, // [11,24] -11.19RH% 112000cts 16.07pF @100.00°C
+  },  {
+     25716, // [12,0] 100.45RH% 88000cts 20.45pF @110.00°C
+     24702, // [12,1]  96.49RH% 89000cts 20.22pF @110.00°C
+     23650, // [12,2]  92.38RH% 90000cts 20.00pF @110.00°C
+     22557, // [12,3]  88.11RH% 91000cts 19.78pF @110.00°C
+     21417, // [12,4]  83.66RH% 92000cts 19.57pF @110.00°C
+     20230, // [12,5]  79.02RH% 93000cts 19.35pF @110.00°C
+     18991, // [12,6]  74.18RH% 94000cts 19.15pF @110.00°C
+     17699, // [12,7]  69.14RH% 95000cts 18.95pF @110.00°C
+     16356, // [12,8]  63.89RH% 96000cts 18.75pF @110.00°C
+     14966, // [12,9]  58.46RH% 97000cts 18.56pF @110.00°C
+     13536, // [12,10]  52.88RH% 98000cts 18.37pF @110.00°C
+     12080, // [12,11]  47.19RH% 99000cts 18.18pF @110.00°C
+     10614, // [12,12]  41.46RH% 100000cts 18.00pF @110.00°C
+      9158, // [12,13]  35.77RH% 101000cts 17.82pF @110.00°C
+      7732, // [12,14]  30.20RH% 102000cts 17.65pF @110.00°C
+      6354, // [12,15]  24.82RH% 103000cts 17.48pF @110.00°C
+      5037, // [12,16]  19.68RH% 104000cts 17.31pF @110.00°C
+      3788, // [12,17]  14.80RH% 105000cts 17.14pF @110.00°C
+      2612, // [12,18]  10.20RH% 106000cts 16.98pF @110.00°C
+      1508, // [12,19]   5.89RH% 107000cts 16.82pF @110.00°C
+       474, // [12,20]   1.85RH% 108000cts 16.67pF @110.00°C
+      -494, // [12,21]  -1.93RH% 109000cts 16.51pF @110.00°C
+     -1402, // [12,22]  -5.48RH% 110000cts 16.36pF @110.00°C
+     -2253, // [12,23]  -8.81RH% 111000cts 16.22pF @110.00°C
+     -3054, // [12,24] -11.93RH% 112000cts 16.07pF @110.00°C
+  },
+};
@@ -0,0 +1,214 @@
+/// HS1101 cap>humidity
+
+#include "HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2.h"
+
+
+const int16_t HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data::_therm_table[_therm_table_size] = 
+{
+   -1521, // [ 0]-11.89°C    192cts 0.619V res=649.2k
+   -1087, // [ 1] -8.50°C    224cts 0.723V res=535.0k
+    -687, // [ 2] -5.37°C    256cts 0.826V res=449.4k
+    -310, // [ 3] -2.43°C    288cts 0.929V res=382.8k
+      49, // [ 4]  0.38°C    320cts 1.032V res=329.5k
+     396, // [ 5]  3.09°C    352cts 1.135V res=285.9k
+     735, // [ 6]  5.74°C    384cts 1.239V res=249.6k
+    1070, // [ 7]  8.36°C    416cts 1.342V res=218.9k
+    1402, // [ 8] 10.95°C    448cts 1.445V res=192.5k
+    1735, // [ 9] 13.56°C    480cts 1.548V res=169.7k
+    2072, // [10] 16.19°C    512cts 1.652V res=149.7k
+    2415, // [11] 18.87°C    544cts 1.755V res=132.1k
+    2767, // [12] 21.62°C    576cts 1.858V res=116.4k
+    3132, // [13] 24.47°C    608cts 1.961V res=102.4k
+    3514, // [14] 27.45°C    640cts 2.065V res=89.8k
+    3916, // [15] 30.59°C    672cts 2.168V res=78.3k
+    4346, // [16] 33.95°C    704cts 2.271V res=68.0k
+    4810, // [17] 37.58°C    736cts 2.374V res=58.5k
+    5319, // [18] 41.56°C    768cts 2.477V res=49.8k
+    5889, // [19] 46.01°C    800cts 2.581V res=41.8k
+    6540, // [20] 51.09°C    832cts 2.684V res=34.4k
+};
+
+const int16_t HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data::_hs1101_table[_humid_table_sizeT][_humid_table_sizeH] = 
+{
+  {
+     27607, // [0,0] 107.84RH%  8500cts 211.76pF @-10.00°C
+     26322, // [0,1] 102.82RH%  8628cts 208.62pF @-10.00°C
+     24976, // [0,2]  97.56RH%  8756cts 205.57pF @-10.00°C
+     23560, // [0,3]  92.03RH%  8884cts 202.61pF @-10.00°C
+     22066, // [0,4]  86.20RH%  9012cts 199.73pF @-10.00°C
+     20484, // [0,5]  80.02RH%  9140cts 196.94pF @-10.00°C
+     18807, // [0,6]  73.46RH%  9268cts 194.22pF @-10.00°C
+     17032, // [0,7]  66.53RH%  9396cts 191.57pF @-10.00°C
+     15163, // [0,8]  59.23RH%  9524cts 189.00pF @-10.00°C
+     13217, // [0,9]  51.63RH%  9652cts 186.49pF @-10.00°C
+     11227, // [0,10]  43.85RH%  9780cts 184.05pF @-10.00°C
+      9237, // [0,11]  36.08RH%  9908cts 181.67pF @-10.00°C
+      7299, // [0,12]  28.51RH% 10036cts 179.35pF @-10.00°C
+      5455, // [0,13]  21.31RH% 10164cts 177.10pF @-10.00°C
+      3734, // [0,14]  14.59RH% 10292cts 174.89pF @-10.00°C
+      2146, // [0,15]   8.38RH% 10420cts 172.74pF @-10.00°C
+       689, // [0,16]   2.69RH% 10548cts 170.65pF @-10.00°C
+      -643, // [0,17]  -2.51RH% 10676cts 168.60pF @-10.00°C
+     -1863, // [0,18]  -7.28RH% 10804cts 166.60pF @-10.00°C
+  },  {
+     27464, // [1,0] 107.28RH%  8500cts 211.76pF @ -2.00°C
+     26170, // [1,1] 102.23RH%  8628cts 208.62pF @ -2.00°C
+     24814, // [1,2]  96.93RH%  8756cts 205.57pF @ -2.00°C
+     23387, // [1,3]  91.36RH%  8884cts 202.61pF @ -2.00°C
+     21880, // [1,4]  85.47RH%  9012cts 199.73pF @ -2.00°C
+     20284, // [1,5]  79.24RH%  9140cts 196.94pF @ -2.00°C
+     18593, // [1,6]  72.63RH%  9268cts 194.22pF @ -2.00°C
+     16803, // [1,7]  65.64RH%  9396cts 191.57pF @ -2.00°C
+     14920, // [1,8]  58.28RH%  9524cts 189.00pF @ -2.00°C
+     12963, // [1,9]  50.64RH%  9652cts 186.49pF @ -2.00°C
+     10966, // [1,10]  42.84RH%  9780cts 184.05pF @ -2.00°C
+      8977, // [1,11]  35.07RH%  9908cts 181.67pF @ -2.00°C
+      7047, // [1,12]  27.53RH% 10036cts 179.35pF @ -2.00°C
+      5215, // [1,13]  20.37RH% 10164cts 177.10pF @ -2.00°C
+      3509, // [1,14]  13.71RH% 10292cts 174.89pF @ -2.00°C
+      1936, // [1,15]   7.56RH% 10420cts 172.74pF @ -2.00°C
+       495, // [1,16]   1.93RH% 10548cts 170.65pF @ -2.00°C
+      -822, // [1,17]  -3.22RH% 10676cts 168.60pF @ -2.00°C
+     -2030, // [1,18]  -7.93RH% 10804cts 166.60pF @ -2.00°C
+  },  {
+     27320, // [2,0] 106.72RH%  8500cts 211.76pF @  6.00°C
+     26017, // [2,1] 101.63RH%  8628cts 208.62pF @  6.00°C
+     24651, // [2,2]  96.29RH%  8756cts 205.57pF @  6.00°C
+     23213, // [2,3]  90.68RH%  8884cts 202.61pF @  6.00°C
+     21693, // [2,4]  84.74RH%  9012cts 199.73pF @  6.00°C
+     20084, // [2,5]  78.45RH%  9140cts 196.94pF @  6.00°C
+     18377, // [2,6]  71.79RH%  9268cts 194.22pF @  6.00°C
+     16572, // [2,7]  64.73RH%  9396cts 191.57pF @  6.00°C
+     14675, // [2,8]  57.33RH%  9524cts 189.00pF @  6.00°C
+     12708, // [2,9]  49.64RH%  9652cts 186.49pF @  6.00°C
+     10706, // [2,10]  41.82RH%  9780cts 184.05pF @  6.00°C
+      8719, // [2,11]  34.06RH%  9908cts 181.67pF @  6.00°C
+      6796, // [2,12]  26.55RH% 10036cts 179.35pF @  6.00°C
+      4978, // [2,13]  19.44RH% 10164cts 177.10pF @  6.00°C
+      3286, // [2,14]  12.84RH% 10292cts 174.89pF @  6.00°C
+      1730, // [2,15]   6.76RH% 10420cts 172.74pF @  6.00°C
+       304, // [2,16]   1.19RH% 10548cts 170.65pF @  6.00°C
+      -999, // [2,17]  -3.91RH% 10676cts 168.60pF @  6.00°C
+     -2194, // [2,18]  -8.57RH% 10804cts 166.60pF @  6.00°C
+  },  {
+     27175, // [3,0] 106.15RH%  8500cts 211.76pF @ 14.00°C
+     25863, // [3,1] 101.03RH%  8628cts 208.62pF @ 14.00°C
+     24487, // [3,2]  95.65RH%  8756cts 205.57pF @ 14.00°C
+     23038, // [3,3]  89.99RH%  8884cts 202.61pF @ 14.00°C
+     21505, // [3,4]  84.00RH%  9012cts 199.73pF @ 14.00°C
+     19881, // [3,5]  77.66RH%  9140cts 196.94pF @ 14.00°C
+     18160, // [3,6]  70.94RH%  9268cts 194.22pF @ 14.00°C
+     16340, // [3,7]  63.83RH%  9396cts 191.57pF @ 14.00°C
+     14430, // [3,8]  56.37RH%  9524cts 189.00pF @ 14.00°C
+     12452, // [3,9]  48.64RH%  9652cts 186.49pF @ 14.00°C
+     10447, // [3,10]  40.81RH%  9780cts 184.05pF @ 14.00°C
+      8462, // [3,11]  33.05RH%  9908cts 181.67pF @ 14.00°C
+      6548, // [3,12]  25.58RH% 10036cts 179.35pF @ 14.00°C
+      4742, // [3,13]  18.52RH% 10164cts 177.10pF @ 14.00°C
+      3066, // [3,14]  11.98RH% 10292cts 174.89pF @ 14.00°C
+      1526, // [3,15]   5.96RH% 10420cts 172.74pF @ 14.00°C
+       115, // [3,16]   0.45RH% 10548cts 170.65pF @ 14.00°C
+     -1174, // [3,17]  -4.59RH% 10676cts 168.60pF @ 14.00°C
+     -2356, // [3,18]  -9.21RH% 10804cts 166.60pF @ 14.00°C
+  },  {
+     27029, // [4,0] 105.58RH%  8500cts 211.76pF @ 22.00°C
+     25709, // [4,1] 100.43RH%  8628cts 208.62pF @ 22.00°C
+     24322, // [4,2]  95.01RH%  8756cts 205.57pF @ 22.00°C
+     22861, // [4,3]  89.30RH%  8884cts 202.61pF @ 22.00°C
+     21316, // [4,4]  83.26RH%  9012cts 199.73pF @ 22.00°C
+     19678, // [4,5]  76.87RH%  9140cts 196.94pF @ 22.00°C
+     17941, // [4,6]  70.08RH%  9268cts 194.22pF @ 22.00°C
+     16106, // [4,7]  62.92RH%  9396cts 191.57pF @ 22.00°C
+     14183, // [4,8]  55.40RH%  9524cts 189.00pF @ 22.00°C
+     12196, // [4,9]  47.64RH%  9652cts 186.49pF @ 22.00°C
+     10187, // [4,10]  39.79RH%  9780cts 184.05pF @ 22.00°C
+      8206, // [4,11]  32.05RH%  9908cts 181.67pF @ 22.00°C
+      6301, // [4,12]  24.61RH% 10036cts 179.35pF @ 22.00°C
+      4509, // [4,13]  17.61RH% 10164cts 177.10pF @ 22.00°C
+      2849, // [4,14]  11.13RH% 10292cts 174.89pF @ 22.00°C
+      1324, // [4,15]   5.17RH% 10420cts 172.74pF @ 22.00°C
+       -70, // [4,16]  -0.28RH% 10548cts 170.65pF @ 22.00°C
+     -1347, // [4,17]  -5.26RH% 10676cts 168.60pF @ 22.00°C
+     -2516, // [4,18]  -9.83RH% 10804cts 166.60pF @ 22.00°C
+  },  {
+     26883, // [5,0] 105.01RH%  8500cts 211.76pF @ 30.00°C
+     25553, // [5,1]  99.82RH%  8628cts 208.62pF @ 30.00°C
+     24156, // [5,2]  94.36RH%  8756cts 205.57pF @ 30.00°C
+     22683, // [5,3]  88.61RH%  8884cts 202.61pF @ 30.00°C
+     21125, // [5,4]  82.52RH%  9012cts 199.73pF @ 30.00°C
+     19473, // [5,5]  76.06RH%  9140cts 196.94pF @ 30.00°C
+     17721, // [5,6]  69.22RH%  9268cts 194.22pF @ 30.00°C
+     15871, // [5,7]  62.00RH%  9396cts 191.57pF @ 30.00°C
+     13935, // [5,8]  54.44RH%  9524cts 189.00pF @ 30.00°C
+     11940, // [5,9]  46.64RH%  9652cts 186.49pF @ 30.00°C
+      9928, // [5,10]  38.78RH%  9780cts 184.05pF @ 30.00°C
+      7951, // [5,11]  31.06RH%  9908cts 181.67pF @ 30.00°C
+      6057, // [5,12]  23.66RH% 10036cts 179.35pF @ 30.00°C
+      4279, // [5,13]  16.71RH% 10164cts 177.10pF @ 30.00°C
+      2634, // [5,14]  10.29RH% 10292cts 174.89pF @ 30.00°C
+      1125, // [5,15]   4.39RH% 10420cts 172.74pF @ 30.00°C
+      -255, // [5,16]  -1.00RH% 10548cts 170.65pF @ 30.00°C
+     -1517, // [5,17]  -5.93RH% 10676cts 168.60pF @ 30.00°C
+     -2675, // [5,18] -10.45RH% 10804cts 166.60pF @ 30.00°C
+  },  {
+     26736, // [6,0] 104.44RH%  8500cts 211.76pF @ 38.00°C
+     25397, // [6,1]  99.21RH%  8628cts 208.62pF @ 38.00°C
+     23989, // [6,2]  93.71RH%  8756cts 205.57pF @ 38.00°C
+     22504, // [6,3]  87.91RH%  8884cts 202.61pF @ 38.00°C
+     20933, // [6,4]  81.77RH%  9012cts 199.73pF @ 38.00°C
+     19266, // [6,5]  75.26RH%  9140cts 196.94pF @ 38.00°C
+     17500, // [6,6]  68.36RH%  9268cts 194.22pF @ 38.00°C
+     15635, // [6,7]  61.08RH%  9396cts 191.57pF @ 38.00°C
+     13687, // [6,8]  53.46RH%  9524cts 189.00pF @ 38.00°C
+     11684, // [6,9]  45.64RH%  9652cts 186.49pF @ 38.00°C
+      9670, // [6,10]  37.77RH%  9780cts 184.05pF @ 38.00°C
+      7698, // [6,11]  30.07RH%  9908cts 181.67pF @ 38.00°C
+      5814, // [6,12]  22.71RH% 10036cts 179.35pF @ 38.00°C
+      4051, // [6,13]  15.82RH% 10164cts 177.10pF @ 38.00°C
+      2422, // [6,14]   9.46RH% 10292cts 174.89pF @ 38.00°C
+       928, // [6,15]   3.63RH% 10420cts 172.74pF @ 38.00°C
+      -436, // [6,16]  -1.71RH% 10548cts 170.65pF @ 38.00°C
+     -1686, // [6,17]  -6.59RH% 10676cts 168.60pF @ 38.00°C
+     -2831, // [6,18] -11.06RH% 10804cts 166.60pF @ 38.00°C
+  },  {
+     26588, // [7,0] 103.86RH%  8500cts 211.76pF @ 46.00°C
+     25240, // [7,1]  98.59RH%  8628cts 208.62pF @ 46.00°C
+     23821, // [7,2]  93.05RH%  8756cts 205.57pF @ 46.00°C
+     22324, // [7,3]  87.20RH%  8884cts 202.61pF @ 46.00°C
+     20739, // [7,4]  81.01RH%  9012cts 199.73pF @ 46.00°C
+     19058, // [7,5]  74.45RH%  9140cts 196.94pF @ 46.00°C
+     17276, // [7,6]  67.49RH%  9268cts 194.22pF @ 46.00°C
+     15398, // [7,7]  60.15RH%  9396cts 191.57pF @ 46.00°C
+     13438, // [7,8]  52.49RH%  9524cts 189.00pF @ 46.00°C
+     11427, // [7,9]  44.64RH%  9652cts 186.49pF @ 46.00°C
+      9413, // [7,10]  36.77RH%  9780cts 184.05pF @ 46.00°C
+      7446, // [7,11]  29.09RH%  9908cts 181.67pF @ 46.00°C
+      5574, // [7,12]  21.77RH% 10036cts 179.35pF @ 46.00°C
+      3825, // [7,13]  14.94RH% 10164cts 177.10pF @ 46.00°C
+      2212, // [7,14]   8.64RH% 10292cts 174.89pF @ 46.00°C
+       734, // [7,15]   2.87RH% 10420cts 172.74pF @ 46.00°C
+      -616, // [7,16]  -2.41RH% 10548cts 170.65pF @ 46.00°C
+     -1852, // [7,17]  -7.24RH% 10676cts 168.60pF @ 46.00°C
+     -2986, // [7,18] -11.67RH% 10804cts 166.60pF @ 46.00°C
+  },  {
+     26440, // [8,0] 103.28RH%  8500cts 211.76pF @ 54.00°C
+     25082, // [8,1]  97.98RH%  8628cts 208.62pF @ 54.00°C
+     23652, // [8,2]  92.39RH%  8756cts 205.57pF @ 54.00°C
+     22143, // [8,3]  86.50RH%  8884cts 202.61pF @ 54.00°C
+     20544, // [8,4]  80.25RH%  9012cts 199.73pF @ 54.00°C
+     18849, // [8,5]  73.63RH%  9140cts 196.94pF @ 54.00°C
+     17052, // [8,6]  66.61RH%  9268cts 194.22pF @ 54.00°C
+     15159, // [8,7]  59.22RH%  9396cts 191.57pF @ 54.00°C
+     13187, // [8,8]  51.51RH%  9524cts 189.00pF @ 54.00°C
+     11170, // [8,9]  43.63RH%  9652cts 186.49pF @ 54.00°C
+      9156, // [8,10]  35.77RH%  9780cts 184.05pF @ 54.00°C
+      7196, // [8,11]  28.11RH%  9908cts 181.67pF @ 54.00°C
+      5336, // [8,12]  20.84RH% 10036cts 179.35pF @ 54.00°C
+      3602, // [8,13]  14.07RH% 10164cts 177.10pF @ 54.00°C
+      2005, // [8,14]   7.83RH% 10292cts 174.89pF @ 54.00°C
+       542, // [8,15]   2.12RH% 10420cts 172.74pF @ 54.00°C
+      -793, // [8,16]  -3.10RH% 10548cts 170.65pF @ 54.00°C
+     -2017, // [8,17]  -7.88RH% 10676cts 168.60pF @ 54.00°C
+     -3138, // [8,18] -12.26RH% 10804cts 166.60pF @ 54.00°C
+  },
+};
@@ -0,0 +1,67 @@
+/** @file
+  @@brief HS1101 humidity sensor and thermistor
+  Generated by H!1101.py <built-in method utcnow of type object at 0x7f442921cee0>
+  */
+#ifndef _HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2_table_H
+#define _HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2_table_H
+
+#include <stdint.h>
+#include "HS1101.h"
+
+//=========================================================================================================================
+/** @brief
+ * Data class for HS1101
+ */     
+class HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data 
+{
+public:
+    static const uint16_t _therm_table_size    =    21; ///< Entries in thermistor table
+    static const uint16_t _therm_table_scale   =   128; ///< Thermistor table values are multiplied by this value
+    static const uint16_t _therm_table_locount =   192; ///< ADC count for lowest bucket
+    static const uint16_t _therm_table_hicount =   832; ///< ADC count for highest bucket
+    static const uint16_t _therm_table_rbits   =     5; ///< Bits in the residue
+    static const uint16_t _therm_table_rmask   =    31; ///< Mask for the residue
+
+
+    static const uint16_t _humid_table_sizeT   =     9; ///< Entries in dim0 of Humidity table (temp index)
+    static const int16_t  _humid_table_tmin    =   -10; ///< low temp in table (temp for first row)
+    static const int16_t  _humid_table_tmax    =    50; ///< hi temp in table (temp for last row)
+    static const int16_t  _humid_table_tminsc  = -1280; ///< low temp, scaled as per thermistor table (x128)
+    static const int16_t  _humid_table_tmaxsc  =  6400; ///< hi temp scaled as per thermistor table (x128)
+    static const int16_t  _humid_table_stepT   =     8; ///< Temperature distance between two rows
+    static const int16_t  _humid_table_stepTsc =  1024; ///< Temperature distance between two rows, scaled (x128)
+                      
+    static const uint16_t _humid_table_sizeH   =    19; ///< Entries in dim1 of Humidity table (freq indexed)
+    static const uint16_t _humid_table_locount =  8500; ///< Offset of first bucket (counts in interval)
+    static const uint16_t _humid_table_hicount = 10800; ///< Offset of last bucket (counts in interval)
+    static const int16_t  _humid_table_stepH   =   128; ///< # counts between column values
+    static const uint16_t _humid_table_scale   =   256; ///< Humidity table values are multiplied by this value
+    static const int16_t _humid_max_raw        = 25600; ///< Humidity table values are multiplied by this value
+    static const uint16_t _humid_table_shiftH  =     7; ///< stepH is 1 << this
+    static const uint16_t _humid_table_shiftTsc=    10; ///< stepTsc is 1 << this
+    
+    // CStray =  8Pf
+
+    /// Scale a raw temp to °C
+    constexpr static double scaleTemp(int16_t raw) { return raw * 0.0078125; }
+                      
+    /// Scale a raw RH to RH% 
+    constexpr static double scaleHumid(int16_t raw) { return raw * 0.00390625; }
+                      
+protected:                      
+    static const int16_t  _therm_table[_therm_table_size];
+    static const int16_t  _hs1101_table[_humid_table_sizeT][_humid_table_sizeH];
+
+    
+};
+
+//=========================================================================================================================
+/**
+ Concrete HS1101 class with logic included
+ */
+class HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2 : public HS1101<HS1101Rt100k0Rs150k0Tl_10Th50Cstray8P2Data>
+{
+};
+//=========================================================================================================================
+                      
+#endif
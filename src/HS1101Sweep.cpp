@@ -0,0 +1,256 @@
+/*
+* HS1101Sweep.cpp
+*
+* Design space sweep over HS1101Generator; see HS1101Sweep.h.
+*/
+
+#ifndef ARDUINO
+
+#include "HS1101Sweep.h"
+#include <algorithm>
+#include <atomic>
+#include <math.h>
+#include <stdio.h>
+#include <thread>
+
+//----------------------------------------------------
+static bool isPow2(int v)
+{
+    return v > 0 && (v & (v - 1)) == 0;
+}
+//----------------------------------------------------
+static bool fitsInt16(double v)
+{
+    return v >= -32768 && v <= 32767;
+}
+//----------------------------------------------------
+/// HS1101Grid's divide: a shift on pow2 grids (floors), else / (truncates)
+static int32_t gridDiv(int32_t x, int step, bool pow2)
+{
+    return pow2 ? x >> ilogb(step) : x / step;
+}
+//----------------------------------------------------
+uint32_t HS1101CycleModel::computeRH(const HS1101GenParams& p) const
+{
+    // a constant power of two divisor is a shift whether or not the
+    // grid is pow2; signed ones need a couple of cycles of fixup
+    const int stepTsc = p.tstep * p.tscale;
+    auto d16 = [this](int step) { return isPow2(step) ? ilogb(step) * shift16 + 4 : divmod16; };
+    auto d32 = [this, &p](int step) { return isPow2(step) ? ilogb(step) * shift32 + (p.pow2 ? 0 : 8) : div32; };
+
+    return base + 4 * load
+        + d16(stepTsc) + d16(p.fcstep)          // buckets and residues
+        + 3 * mul32
+        + 2 * d32(p.fcstep) + d32(stepTsc);     // two along rows, one between
+}
+//----------------------------------------------------
+bool HS1101SweepResult::dominates(const HS1101SweepResult& o) const
+{
+    if (rhErr > o.rhErr || tempErr > o.tempErr || bytes > o.bytes || cycles > o.cycles)
+        return false;
+    return rhErr < o.rhErr || tempErr < o.tempErr || bytes < o.bytes || cycles < o.cycles;
+}
+//----------------------------------------------------
+HS1101Sweep::HS1101Sweep(const HS1101SweepSpace& s, int samples, const HS1101CycleModel& model)
+    :   _s(s),
+        _model(model),
+        _samples(samples < 1 ? 1 : samples)
+{}
+//----------------------------------------------------
+size_t HS1101Sweep::size() const
+{
+    return _s.rsense.size() * _s.rOsc.size() * _s.cStrayPf.size() * _s.tmin.size() * _s.tmax.size()
+        * _s.tstep.size() * _s.tscale.size() * _s.fcstep.size() * _s.hscale.size() * _s.pow2.size();
+}
+//----------------------------------------------------
+bool HS1101Sweep::candidate(size_t i, HS1101GenParams& p) const
+{
+    // mixed radix, last axis fastest
+    auto pick = [&i](size_t n) { size_t d = i % n; i /= n; return d; };
+
+    p = _s.base;
+    p.name.clear();
+    size_t ipow2 = pick(_s.pow2.size());
+    p.pow2 = _s.pow2[ipow2];
+    p.hscale = _s.hscale[pick(_s.hscale.size())];
+    size_t ifc = pick(_s.fcstep.size());
+    size_t isc = pick(_s.tscale.size());
+    size_t ist = pick(_s.tstep.size());
+    p.fcstep = _s.fcstep[ifc];
+    p.tscale = _s.tscale[isc];
+    p.tstep = _s.tstep[ist];
+    p.tmax = _s.tmax[pick(_s.tmax.size())];
+    p.tmin = _s.tmin[pick(_s.tmin.size())];
+    p.cStrayPf = _s.cStrayPf[pick(_s.cStrayPf.size())];
+    p.rOsc = _s.rOsc[pick(_s.rOsc.size())];
+    p.rsense = _s.rsense[pick(_s.rsense.size())];
+
+    if (p.pow2 && (ifc || isc || ist))
+        return false;
+    return p.tmin < p.tmax && p.tstep > 0 && p.fcstep > 0;
+}
+//----------------------------------------------------
+HS1101SweepResult HS1101Sweep::evaluate(HS1101GenParams p) const
+{
+    HS1101SweepResult res;
+
+    if (_s.fitCounts)
+    {
+        // the generator settles the steps (pow2 overrides them)
+        HS1101Generator steps(p);
+        const int step = steps.params().fcstep;
+        double lo = steps.countsFromCap(HS1101Generator::capFromRHTemp(_s.rhHi, p.tmax));
+        double hi = steps.countsFromCap(HS1101Generator::capFromRHTemp(_s.rhLo, p.tmin));
+        p.fcmin = int(lo / step) * step;
+        p.fcmax = p.fcmin + int(ceil((hi - p.fcmin) / step)) * step;
+    }
+
+    HS1101Generator g(p);
+    const HS1101GenParams& q = g.params();
+    res.params = q;
+
+    // everything computeRH() and rawTemp() keep in 16 bits, and 8 bit cell indices
+    const int stepTsc = q.tstep * q.tscale;
+    const int tminsc = q.tmin * q.tscale, tmaxsc = q.tmax * q.tscale;
+    const double rhMax = HS1101Generator::rhFromCapTemp(g.capFromCounts(q.fcmin), q.tmax);
+    const double rhMin = HS1101Generator::rhFromCapTemp(g.capFromCounts(q.fcmin + (g.sizeH() - 1) * q.fcstep), q.tmin);
+    if (q.fcmin <= 0 || q.fcmax > 65535 || g.sizeT() > 255 || g.sizeH() > 255
+        || !fitsInt16(tminsc) || !fitsInt16(tmaxsc) || !fitsInt16(stepTsc)
+        || !fitsInt16(rhMax * q.hscale) || !fitsInt16(rhMin * q.hscale) || !fitsInt16(100 * q.hscale))
+        return res;
+
+    g.generate(1);
+    const std::vector<int16_t>& therm = g.thermTable();
+    const std::vector<int16_t>& humid = g.humidTable();
+    const int tlo = g.thermLoCount(), thi = std::min<int>(g.thermHiCount(), (1 << q.tadcbits) - 1);
+    if (tlo <= 0 || !fitsInt16(g.tempForCounts(thi) * q.tscale) || !fitsInt16(g.tempForCounts(tlo) * q.tscale))
+        return res;
+
+    // rawTemp() at every ADC count the table covers
+    const int rmask = (1 << q.tresiduebits) - 1;
+    for (int adc = tlo + 1; adc < thi; ++adc)
+    {
+        int adc0 = adc - tlo;
+        int ix = adc0 >> q.tresiduebits;
+        int lb = therm[ix], hb = therm[ix + 1];
+        int raw = lb + (((hb - lb) * (adc0 & rmask)) >> q.tresiduebits);
+        res.tempErr = std::max(res.tempErr, fabs(double(raw) / q.tscale - g.tempForCounts(adc)));
+    }
+
+    // computeRH() at samples x samples points per cell
+    const int sizeH = g.sizeH();
+    const int hmaxraw = 100 * q.hscale;
+    const int dc = std::max(1, q.fcstep / _samples), dt = std::max(1, stepTsc / _samples);
+    for (int t = tminsc; t <= tmaxsc; t += dt)
+    {
+        const int tadj = t - tminsc;
+        const int tb0 = gridDiv(tadj, stepTsc, q.pow2);
+        const int tres = tadj - tb0 * stepTsc;
+        const int16_t* row0 = &humid[size_t(tb0) * sizeH];
+        const int16_t* row1 = tres ? row0 + sizeH : row0;
+
+        for (int c = q.fcmin + 1; c < q.fcmax; c += dc)
+        {
+            const int fadj = c - q.fcmin;
+            const int fb0 = gridDiv(fadj, q.fcstep, q.pow2);
+            const int fres = fadj - fb0 * q.fcstep;
+
+            int32_t rh = row0[fb0] + gridDiv(int32_t(fres) * (row0[fb0 + 1] - row0[fb0]), q.fcstep, q.pow2);
+            if (tres)
+            {
+                int32_t rh1 = row1[fb0] + gridDiv(int32_t(fres) * (row1[fb0 + 1] - row1[fb0]), q.fcstep, q.pow2);
+                rh += gridDiv(int32_t(tres) * (rh1 - rh), stepTsc, q.pow2);
+            }
+            rh = rh < 0 ? 0 : rh > hmaxraw ? hmaxraw : rh;
+
+            double model = HS1101Generator::rhFromCapTemp(g.capFromCounts(c), double(t) / q.tscale);
+            model = model < 0 ? 0 : model > 100 ? 100 : model;
+            res.rhErr = std::max(res.rhErr, fabs(double(rh) / q.hscale - model));
+        }
+    }
+
+    res.bytes = uint32_t((therm.size() + humid.size()) * sizeof(int16_t));
+    res.cycles = _model.computeRH(q);
+    res.valid = true;
+    return res;
+}
+//----------------------------------------------------
+std::vector<HS1101SweepResult> HS1101Sweep::run(unsigned threads) const
+{
+    const size_t n = size();
+    std::vector<HS1101SweepResult> all(n);
+    std::atomic<size_t> next(0);
+
+    auto work = [&]()
+    {
+        HS1101GenParams p;
+        for (size_t i = next++; i < n; i = next++)
+            if (candidate(i, p))
+                all[i] = evaluate(p);
+    };
+
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads <= 1)
+        work();
+    else
+    {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t)
+            pool.emplace_back(work);
+        for (std::thread& th : pool)
+            th.join();
+    }
+
+    std::vector<HS1101SweepResult> valid;
+    for (const HS1101SweepResult& r : all)
+        if (r.valid)
+            valid.push_back(r);
+    return valid;
+}
+//----------------------------------------------------
+std::vector<HS1101SweepResult> HS1101Sweep::pareto(const std::vector<HS1101SweepResult>& r)
+{
+    // by bytes then the rest, so anything dominating r[i] sorts before it
+    std::vector<HS1101SweepResult> sorted(r);
+    std::sort(sorted.begin(), sorted.end(), [](const HS1101SweepResult& a, const HS1101SweepResult& b)
+    {
+        if (a.bytes != b.bytes) return a.bytes < b.bytes;
+        if (a.cycles != b.cycles) return a.cycles < b.cycles;
+        if (a.rhErr != b.rhErr) return a.rhErr < b.rhErr;
+        return a.tempErr < b.tempErr;
+    });
+
+    std::vector<HS1101SweepResult> front;
+    for (const HS1101SweepResult& c : sorted)
+    {
+        bool beaten = false;
+        for (const HS1101SweepResult& f : front)
+            if (f.dominates(c) || (f.rhErr == c.rhErr && f.tempErr == c.tempErr && f.bytes == c.bytes && f.cycles == c.cycles))
+            {
+                beaten = true;
+                break;
+            }
+        if (!beaten)
+            front.push_back(c);
+    }
+    return front;
+}
+//----------------------------------------------------
+std::string HS1101Sweep::csv(const std::vector<HS1101SweepResult>& r)
+{
+    std::string s = "name,rsense,rOsc,cStrayPf,tmin,tmax,tstep,tscale,fcmin,fcmax,fcstep,hscale,pow2,"
+                    "rhErr,tempErr,bytes,cycles\n";
+    for (const HS1101SweepResult& x : r)
+    {
+        const HS1101GenParams& p = x.params;
+        char buf[320];
+        snprintf(buf, sizeof(buf), "%s,%.0f,%.0f,%g,%d,%d,%d,%d,%d,%d,%d,%d,%d,%.4f,%.4f,%u,%u\n",
+            p.name.c_str(), p.rsense, p.rOsc, p.cStrayPf, p.tmin, p.tmax, p.tstep, p.tscale,
+            p.fcmin, p.fcmax, p.fcstep, p.hscale, int(p.pow2), x.rhErr, x.tempErr, x.bytes, x.cycles);
+        s += buf;
+    }
+    return s;
+}
+
+#endif
@@ -0,0 +1,138 @@
+/** @file
+    Design space sweep for the HS1101 and thermistor circuit.
+
+    Every combination of the candidate values in an HS1101SweepSpace is
+    generated with HS1101Generator and scored on
+      - worst case RH error of computeRH() against the sensor model,
+        sampled inside every table cell,
+      - worst case temperature error of rawTemp() over every ADC count,
+      - table bytes (thermistor plus humidity),
+      - an AVR cycle estimate for computeRH() (HS1101CycleModel).
+    Candidates are spread over threads; pareto() keeps those no other
+    candidate beats on all four.
+
+        HS1101SweepSpace s;
+        s.rsense = { 100000, 150000 };
+        s.cStrayPf = { 0, 4, 8 };
+        s.tstep = { 5, 10 };
+        s.pow2 = { false, true };
+        auto front = HS1101Sweep::pareto(HS1101Sweep(s).run());
+        printf("%s", HS1101Sweep::csv(front).c_str());
+
+    With fitCounts the oscillator count range of each candidate is chosen
+    to cover rhLo..rhHi over its whole temperature range, since rOsc and
+    cStrayPf move it; otherwise base's fcmin/fcmax are used as given.
+
+    Host only; not built for ARDUINO.
+ */
+#ifndef HS1101_SWEEP_H
+#define HS1101_SWEEP_H
+
+#ifndef ARDUINO
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "HS1101Generator.h"
+
+//-----------------------------------------------
+/// Candidate values per parameter; everything else comes from base
+struct HS1101SweepSpace
+{
+    HS1101GenParams base;
+
+    std::vector<double> rsense   = { 100000 };
+    std::vector<double> rOsc     = { 402700 };
+    std::vector<double> cStrayPf = { 0 };
+    std::vector<int> tmin        = { -10 };
+    std::vector<int> tmax        = { 110 };
+    std::vector<int> tstep       = { 10 };     ///< ignored for pow2
+    std::vector<int> tscale      = { 127 };    ///< ignored for pow2
+    std::vector<int> fcstep      = { 100 };    ///< ignored for pow2
+    std::vector<int> hscale      = { 256 };
+    std::vector<bool> pow2       = { false };
+
+    bool fitCounts = true;  ///< choose fcmin/fcmax to cover rhLo..rhHi
+    double rhLo = 0;
+    double rhHi = 100;
+};
+//-----------------------------------------------
+/**
+    Rough ATtiny cycle costs. The tinyAVR 0/1-series has the 2 cycle
+    8x8 MUL, so a 16x16->32 multiply is four of them and the adds in
+    __mulhisi3; there is no divide, so that's a library loop; shifts
+    loop a bit at a time. Hand counts of the libgcc routines, call and
+    return included, not measured.
+ */
+struct HS1101CycleModel
+{
+    uint32_t base = 80;         ///< range checks, clamps, call overhead
+    uint32_t load = 6;          ///< one table entry from flash
+    uint32_t mul32 = 20;        ///< 16x16->32 multiply, __mulhisi3 on MUL
+    uint32_t divmod16 = 210;    ///< __divmodhi4, quotient and remainder
+    uint32_t div32 = 620;       ///< __divmodsi4
+    uint32_t shift16 = 3;       ///< per bit of a 16 bit shift
+    uint32_t shift32 = 5;       ///< per bit of a 32 bit shift
+
+    /// Worst case (a temperature residue, so both rows) computeRH()
+    uint32_t computeRH(const HS1101GenParams& p) const;
+};
+//-----------------------------------------------
+/// One candidate's scores
+struct HS1101SweepResult
+{
+    HS1101GenParams params;     ///< as generated, fcmin/fcmax fitted
+    bool valid = false;         ///< false if the tables don't fit their types
+    double rhErr = 0;           ///< worst |computeRH() - model|, RH%
+    double tempErr = 0;         ///< worst |rawTemp() - model|, C
+    uint32_t bytes = 0;
+    uint32_t cycles = 0;
+
+    /// No worse on every score and better on one
+    bool dominates(const HS1101SweepResult& o) const;
+};
+//-----------------------------------------------
+//-----------------------------------------------
+class HS1101Sweep
+{
+    HS1101SweepSpace _s;
+    HS1101CycleModel _model;
+    int _samples;
+
+public:
+    /**
+        @param samples  Points per cell edge the RH error is sampled at
+     */
+    explicit HS1101Sweep(const HS1101SweepSpace& s, int samples = 8,
+                         const HS1101CycleModel& model = HS1101CycleModel());
+
+    /// Combinations in the space, including ones candidate() skips
+    size_t size() const;
+
+    /**
+        Parameters for combination i.
+        @return false if i only differs from another in values pow2
+                ignores, or tmin/tmax are the wrong way round
+     */
+    bool candidate(size_t i, HS1101GenParams& p) const;
+
+    /// Generate and score one set of parameters
+    HS1101SweepResult evaluate(HS1101GenParams p) const;
+
+    /**
+        Score every candidate.
+        @param threads  0 for one per core
+        @return the valid results, in combination order
+     */
+    std::vector<HS1101SweepResult> run(unsigned threads = 0) const;
+
+    /// Results no other result dominates, smallest tables first
+    static std::vector<HS1101SweepResult> pareto(const std::vector<HS1101SweepResult>& r);
+
+    /// One line per result, with a header line
+    static std::string csv(const std::vector<HS1101SweepResult>& r);
+};
+
+#endif
+
+#endif
@@ -4,7 +4,10 @@
  #ifndef THERMISTOR_H
  #define THERMISTOR_H
 
+ #include <stddef.h>
  #include <stdint.h>
+ #include "ConstDivider.h"
+ #include "InterpolatedLookupBatch.h"
 
  //-----------------------------------------------
  //-----------------------------------------------
@@ -29,6 +32,12 @@ public:
     //---------------------------------------------------------
     static constexpr TI tableSize() { return 1 << (TOTALBITS - RESIDUEBITS); }
     //---------------------------------------------------------
+    /// Input value of the first entry
+    static constexpr int32_t offset() { return 0; }
+    //---------------------------------------------------------
+    /// Nothing to prove; shift and mask only
+    static bool verify() { return true; }
+    //---------------------------------------------------------
 };
 //-----------------------------------------------
 //-----------------------------------------------
@@ -39,12 +48,17 @@ class ScaledPartitioner
 {
 public:
     typedef TI index_t;
+    /// Inputs are >= 0, so the largest positive TI bounds them, signed or not
+    typedef ConstDivider<
+        RESIDUE,
+        TI(-1) < 0 ? (uint32_t(1) << (8 * sizeof(TI) - 1)) - 1 : uint32_t(TI(~TI(0)))
+    > divider_t;
 
     //---------------------------------------------------------
     static void partition(TI v, TI& bucket, TI& residue)
     {
-        bucket = v / RESIDUE;
-        residue = v % RESIDUE;
+        bucket = divider_t::div(v);
+        residue = v - bucket * RESIDUE;
     }
 
     //---------------------------------------------------------
@@ -52,23 +66,42 @@ public:
     //---------------------------------------------------------
     static constexpr TI tableSize() { return BUCKETS; }
     //---------------------------------------------------------
+    /// Input value of the first entry
+    static constexpr int32_t offset() { return 0; }
+    //---------------------------------------------------------
+    /// Check the divide-free split against v / RESIDUE for every v
+    static bool verify() { return divider_t::verify(); }
+    //---------------------------------------------------------
 };
 //-----------------------------------------------
 //-----------------------------------------------
 /**
+    OFFSET may be negative with a signed TI, e.g. a scaled temperature
+    axis starting below 0C. Inputs are clamped to the table's span, so
+    one below OFFSET is the first entry and one past the last entry is
+    the last, whatever the lookup does about range.
  */
-template<typename TI, unsigned BUCKETS, unsigned RESIDUE, unsigned OFFSET>
+template<typename TI, unsigned BUCKETS, unsigned RESIDUE, int32_t OFFSET>
 class ScaledOffsetPartitioner
 {
+    /// Input span of the table, first entry to last
+    static const int32_t span = int32_t(BUCKETS - 1) * int32_t(RESIDUE);
+
 public:
     typedef TI index_t;
+    /// v - OFFSET is clamped to 0..span, which bounds the divide
+    typedef ConstDivider<RESIDUE, uint32_t(span)> divider_t;
 
     //---------------------------------------------------------
     static void partition(TI v, TI& bucket, TI& residue)
     {
-        v -= OFFSET;
-        bucket = v / RESIDUE;
-        residue = v % RESIDUE;
+        int32_t x = int32_t(v) - OFFSET;
+        if (x <= 0)
+            x = 0;
+        else if (x > span)
+            x = span;
+        bucket = TI(divider_t::div(uint32_t(x)));
+        residue = TI(x - int32_t(bucket) * int32_t(RESIDUE));
     }
 
     //---------------------------------------------------------
@@ -76,6 +109,12 @@ public:
     //---------------------------------------------------------
     static constexpr TI tableSize() { return BUCKETS; }
     //---------------------------------------------------------
+    /// Input value of the first entry
+    static constexpr int32_t offset() { return OFFSET; }
+    //---------------------------------------------------------
+    /// Check the divide-free split against v / RESIDUE for every v
+    static bool verify() { return divider_t::verify(); }
+    //---------------------------------------------------------
 };
 //-----------------------------------------------
 //-----------------------------------------------
@@ -87,9 +126,30 @@ public:
     virtual float lookupScaleFactor() const = 0;
 };
 //-----------------------------------------------
+//-----------------------------------------------
+/**
+    Static (CRTP) counterpart of ILookup.
+
+    Generic code written against LookupBase<D> gets the same three
+    calls as ILookup, but they bind at compile time, so the partition
+    and interpolation inline into the caller.
+
+    @tparam D Concrete lookup; needs raw(), getScale() and getScaleFactor()
+ */
+template<typename D>
+class LookupBase
+{
+public:
+    const D& self() const { return *static_cast<const D*>(this); }
+
+    int32_t lookupRaw(int32_t v) const { return self().raw(v); }
+    int32_t lookupScale() const { return self().getScale(); }
+    float lookupScaleFactor() const { return self().getScaleFactor(); }
+};
+//-----------------------------------------------
 //-----------------------------------------------
  /**
-     1D lookup w
+     1D lookup without virtual dispatch; no vptr.
 
      @tparam TT Table intrinsic type
      @tparam TR Table real type; i.e. type table uses for storage
@@ -97,15 +157,30 @@ public:
 
   */
  template<typename TT, typename TR, typename TP>
- class InterpolatedLookup1D : public ILookup
+ class InterpolatedLookup1DStatic : public LookupBase< InterpolatedLookup1DStatic<TT, TR, TP> >
  {
  protected:
      const TT* _table;
      const TR _scale;
      const float _scaleFactor;
  public:
+     typedef TT table_t;
+     typedef TP partitioner_t;
+
+     /// Replaces the divide by maxResidue() in the interpolation; exact
+     /// up to the largest |residue * diff| (plus rounding) a TT table has.
+     /// For int16 tables that's over 32 bits of product, so it's the
+     /// split 16x16->32 form (ConstDivider::isSplit()), not the 64 bit one
+     typedef ConstDivider<
+         TP::maxResidue(),
+         sizeof(TT) <= 2
+             ? uint32_t(TP::maxResidue()) * ((uint32_t(1) << (8 * sizeof(TT))) - 1) + TP::maxResidue() / 2
+             : 0x7fffffff
+     > residue_divider_t;
+     static_assert(sizeof(TT) > 2 || residue_divider_t::isPow2() || residue_divider_t::isNarrow()
+         || residue_divider_t::isSplit() || residue_divider_t::isLong(), "interpolation would need a 64 bit multiply");
      //----------------------------------------------------------
-     InterpolatedLookup1D(
+     constexpr InterpolatedLookup1DStatic(
          const TT* table,
          TR scale
      )
@@ -120,6 +195,13 @@ public:
      /// Get raw value in last entry - upper limit of reasonably accurate values
      TT hiRaw() const { return _table[ TP::tableSize() - 1]; }
      //----------------------------------------------------------
+     /// Table in use
+     const TT* table() const { return _table; }
+     //----------------------------------------------------------
+     TR getScale() const { return _scale; }
+     //----------------------------------------------------------
+     float getScaleFactor() const { return _scaleFactor; }
+     //----------------------------------------------------------
      /**
          @param tv Value to scale
          @return scalked raw value
@@ -135,7 +217,7 @@ public:
      static TT interpol(TT t0, TT t1, typename TP::index_t residue)
      {
          auto diff = t1 - t0;
-         return t0 + ((diff * residue + TP::maxResidue() / 2) / TP::maxResidue() );
+         return t0 + residue_divider_t::divSigned(int32_t(diff) * residue + TP::maxResidue() / 2);
      }
      //----------------------------------------------------------    
      static TT interpol(const TT* row, typename TP::index_t index, typename TP::index_t residue)
@@ -152,6 +234,17 @@ public:
          @return Interpolated value in table units
       */
      TT raw(typename TP::index_t count) const
+     {
+         return rawFrom(_table, count);
+     }
+     //----------------------------------------------------------
+     /**
+         raw() for any table of this shape; what LookupHandle calls.
+         @param table Table to use
+         @param count ADC counts
+         @return Interpolated value in table units
+      */
+     static TT rawFrom(const TT* table, typename TP::index_t count)
      {
          typename TP::index_t bucket, residue;
 
@@ -159,19 +252,30 @@ public:
 
 
          if (bucket < 1)
-             return loRaw();
+             return table[0];
 
-         if (bucket >= TP::tableSize() )
-             return hiRaw();
+         // last entry has no upper neighbour
+         if (bucket >= TP::tableSize() - 1)
+             return table[TP::tableSize() - 1];
 
-         auto bp = _table + bucket;
+         auto bp = table + bucket;
          auto lv = *bp++;
          auto hv = *bp;
          auto diff = hv - lv; // diff in table units
-         auto corr = residue * diff / TP::maxResidue();
+         auto corr = residue_divider_t::divSigned(int32_t(residue) * diff);
          return lv + corr;
      }
      //----------------------------------------------------------
+     /**
+         Prove the divide-free partition and interpolation match the
+         division they replace, over every input they can see.
+         Slow (a few million divisions); for host tests, not the MCU.
+      */
+     static bool verifyDivisionFree()
+     {
+         return TP::verify() && residue_divider_t::verify();
+     }
+     //----------------------------------------------------------
      /**
          Get the scaled value for a given count.
          @param count ADC counts
@@ -182,16 +286,121 @@ public:
          return scale(raw(count));
      }
      //----------------------------------------------------------
+     /**
+         Get the raw values for a block of counts.
+         Uses the vector kernel for the table/partitioner pair where
+         there is one; results are identical to calling raw() per count.
+         @param counts ADC counts
+         @param[out] out Interpolated values in table units
+         @param n Number of counts
+      */
+     void rawBatch(const typename TP::index_t* counts, TT* out, size_t n) const
+     {
+         size_t i = InterpolatedBatch<TT, TP>::raw(_table, counts, out, n);
+
+         for (; i < n; ++i)
+             out[i] = raw(counts[i]);
+     }
+     //----------------------------------------------------------
+     /**
+         Get the scaled values for a block of counts.
+         @param counts ADC counts
+         @param[out] out Scaled values
+         @param n Number of counts
+      */
+     void valueBatch(const typename TP::index_t* counts, TR* out, size_t n) const
+     {
+         TT tmp[32];
+
+         while (n)
+         {
+             size_t chunk = n < 32 ? n : 32;
+             rawBatch(counts, tmp, chunk);
+             for (size_t i = 0; i < chunk; ++i)
+                 out[i] = scale(tmp[i]);
+             counts += chunk;
+             out += chunk;
+             n -= chunk;
+         }
+     }
+     //----------------------------------------------------------
+ };
+ //-----------------------------------------------
+ //-----------------------------------------------
+ /**
+     1D lookup, also usable through ILookup.
+
+     @tparam TT Table intrinsic type
+     @tparam TR Table real type; i.e. type table uses for storage
+     @tparam TP Partitioner type
+
+  */
+ template<typename TT, typename TR, typename TP>
+ class InterpolatedLookup1D
+     : public InterpolatedLookup1DStatic<TT, TR, TP>,
+       public ILookup
+ {
+     typedef InterpolatedLookup1DStatic<TT, TR, TP> base_t;
+
+ public:
+     //----------------------------------------------------------
+     constexpr InterpolatedLookup1D(
+         const TT* table,
+         TR scale
+     )
+         : base_t(table, scale)
+     {}
+     //----------------------------------------------------------
      /**
      * Ilookup method
      */
-     virtual int32_t lookupRaw(int32_t v) const { return raw(v); }
+     virtual int32_t lookupRaw(int32_t v) const { return this->raw(v); }
      /**
      * Ilookup method
      */
-     virtual int32_t lookupScale() const { return _scale;  }
-     virtual float lookupScaleFactor() const { return _scaleFactor; }
+     virtual int32_t lookupScale() const { return this->_scale;  }
+     virtual float lookupScaleFactor() const { return this->_scaleFactor; }
+
+ };
+ //-----------------------------------------------
+ //-----------------------------------------------
+ /**
+     Type-erased lookup: a function pointer and a table pointer.
+
+     For when the table has to be picked at run time but a vptr (and
+     virtual call through the object) isn't wanted; the call goes
+     straight to the rawFrom() for the table's shape.
+  */
+ class LookupHandle
+ {
+     typedef int32_t(*RawFn)(const void* table, int32_t v);
 
+     RawFn _raw;
+     const void* _table;
+     int32_t _scale;
+     float _scaleFactor;
+
+     //----------------------------------------------------------
+     template<typename TT, typename TR, typename TP>
+     static int32_t rawThunk(const void* table, int32_t v)
+     {
+         return InterpolatedLookup1DStatic<TT, TR, TP>::rawFrom(static_cast<const TT*>(table), v);
+     }
+
+ public:
+     //----------------------------------------------------------
+     template<typename TT, typename TR, typename TP>
+     constexpr LookupHandle(const InterpolatedLookup1DStatic<TT, TR, TP>& l)
+         :  _raw(&rawThunk<TT, TR, TP>),
+            _table(l.table()),
+            _scale(l.getScale()),
+            _scaleFactor(l.getScaleFactor())
+     {}
+     //----------------------------------------------------------
+     int32_t lookupRaw(int32_t v) const { return _raw(_table, v); }
+     int32_t lookupScale() const { return _scale; }
+     float lookupScaleFactor() const { return _scaleFactor; }
+     //----------------------------------------------------------
  };
  //-----------------------------------------------
  //-----------------------------------------------
@@ -200,16 +409,18 @@ public:
 
      @tparam TT Table intrinsic type
      @tparam TR Table real type
+     @tparam TL Lookup base; InterpolatedLookup1DStatic for no vptr
   */
- template<typename TT, typename TR, unsigned TOTALBITS, unsigned RESIDUEBITS>
+ template<typename TT, typename TR, unsigned TOTALBITS, unsigned RESIDUEBITS,
+          template<typename, typename, typename> class TL = InterpolatedLookup1D>
  class InterpolatedLookup1DBits
-     : public InterpolatedLookup1D<
+     : public TL<
      TT,
      TR,
      BitPartitioner<uint16_t, TOTALBITS, RESIDUEBITS>
      >
  {
-     typedef InterpolatedLookup1D<
+     typedef TL<
          TT,
          TR,
          BitPartitioner<uint16_t, TOTALBITS, RESIDUEBITS>
@@ -218,7 +429,7 @@ public:
 
  public:
      //----------------------------------------------------------
-     InterpolatedLookup1DBits(
+     constexpr InterpolatedLookup1DBits(
          const TT* table,
          TR scale
      )
@@ -235,16 +446,18 @@ public:
 
       @tparam TT Table intrinsic type
       @tparam TR Table real type
+      @tparam TL Lookup base; InterpolatedLookup1DStatic for no vptr
    */
- template<typename TT, typename TR, unsigned BUCKETS, unsigned RESIDUE>
+ template<typename TT, typename TR, unsigned BUCKETS, unsigned RESIDUE,
+          template<typename, typename, typename> class TL = InterpolatedLookup1D>
  class InterpolatedLookup1DScaled
-     : public InterpolatedLookup1D<
+     : public TL<
      TT,
      TR,
      ScaledPartitioner<uint16_t, BUCKETS, RESIDUE>
      >
  {
-     typedef InterpolatedLookup1D<
+     typedef TL<
          TT,
          TR,
          ScaledPartitioner<uint16_t, BUCKETS, RESIDUE>
@@ -253,7 +466,7 @@ public:
 
  public:
      //----------------------------------------------------------
-     InterpolatedLookup1DScaled(
+     constexpr InterpolatedLookup1DScaled(
          const TT* table,
          TR scale
      )
@@ -270,16 +483,18 @@ public:
 
        @tparam TT Table intrinsic type
        @tparam TR Table real type
+       @tparam TL Lookup base; InterpolatedLookup1DStatic for no vptr
     */
- template<typename TT, typename TR, unsigned BUCKETS, unsigned RESIDUE, unsigned OFFSET>
+ template<typename TT, typename TR, unsigned BUCKETS, unsigned RESIDUE, int32_t OFFSET,
+          template<typename, typename, typename> class TL = InterpolatedLookup1D>
  class InterpolatedLookup1DScaledOffset
-     : public InterpolatedLookup1D<
+     : public TL<
      TT,
      TR,
      ScaledOffsetPartitioner<uint16_t, BUCKETS, RESIDUE, OFFSET>
      >
  {
-     typedef InterpolatedLookup1D<
+     typedef TL<
          TT,
          TR,
          ScaledOffsetPartitioner<uint16_t, BUCKETS, RESIDUE, OFFSET>
@@ -288,7 +503,7 @@ public:
 
  public:
      //----------------------------------------------------------
-     InterpolatedLookup1DScaledOffset(
+     constexpr InterpolatedLookup1DScaledOffset(
          const TT* table,
          TR scale
      )
@@ -0,0 +1,142 @@
+/** @file
+    Vectorised kernels behind InterpolatedLookup1D::rawBatch().
+
+    Each kernel converts as many leading counts as it can and returns
+    how many it did; the lookup finishes the tail with its scalar raw(),
+    so the results are always bit-identical to calling raw() per count.
+
+    Kernels are only compiled in for hosts that have the instructions
+    (__AVX2__, __SSE2__); on the AVR the generic version converts nothing
+    and rawBatch() is just the scalar loop.
+ */
+#ifndef INTERPOLATED_LOOKUP_BATCH_H
+#define INTERPOLATED_LOOKUP_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+template< typename TI, unsigned TOTALBITS, unsigned RESIDUEBITS>
+class BitPartitioner;
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Generic batch kernel: no vector path, everything goes to raw().
+
+    @tparam TT Table intrinsic type
+    @tparam TP Partitioner type
+ */
+template<typename TT, typename TP>
+struct InterpolatedBatch
+{
+    //---------------------------------------------------------
+    static size_t raw(const TT*, const typename TP::index_t*, TT*, size_t)
+    {
+        return 0;
+    }
+    //---------------------------------------------------------
+};
+
+#if defined(__AVX2__) || defined(__SSE2__)
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    int16_t tables split on a bit boundary (the TempTable* classes).
+
+    The interpolation is the same integer expression as raw():
+    lv + residue*(hv-lv)/maxResidue, with the truncating division done
+    in float. With |hv-lv| < 2^16 and maxResidue < 256 the product is
+    below 2^24 (so exact) and a non-integer quotient sits at least
+    1/maxResidue from an integer, well clear of the rounding error, so
+    truncation gives the integer quotient. Wider residues fall back to raw().
+ */
+template<unsigned TOTALBITS, unsigned RESIDUEBITS>
+struct InterpolatedBatch<int16_t, BitPartitioner<uint16_t, TOTALBITS, RESIDUEBITS> >
+{
+    typedef BitPartitioner<uint16_t, TOTALBITS, RESIDUEBITS> TP;
+
+    //---------------------------------------------------------
+    static size_t raw(const int16_t* table, const uint16_t* counts, int16_t* out, size_t n)
+    {
+        const int32_t last = TP::tableSize() - 1;
+        size_t i = 0;
+
+        if (RESIDUEBITS > 8)
+            return 0;
+#if defined(__AVX2__)
+        const __m256i mask = _mm256_set1_epi32(TP::maxResidue());
+        const __m256i gmax = _mm256_set1_epi32(last - 1);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i lo = _mm256_set1_epi32(table[0]);
+        const __m256i hi = _mm256_set1_epi32(table[last]);
+        const __m256 div = _mm256_set1_ps(TP::maxResidue());
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(counts + i)));
+            __m256i bucket = _mm256_srli_epi32(v, RESIDUEBITS);
+            __m256i residue = _mm256_and_si256(v, mask);
+
+            // one 32 bit gather picks up both neighbours; keep it inside the table
+            __m256i pair = _mm256_i32gather_epi32((const int*)table, _mm256_min_epi32(bucket, gmax), 2);
+            __m256i lv = _mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16);
+            __m256i hv = _mm256_srai_epi32(pair, 16);
+
+            __m256i prod = _mm256_mullo_epi32(residue, _mm256_sub_epi32(hv, lv));
+            __m256i corr = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(prod), div));
+            __m256i r = _mm256_add_epi32(lv, corr);
+
+            r = _mm256_blendv_epi8(r, lo, _mm256_cmpeq_epi32(bucket, zero));
+            r = _mm256_blendv_epi8(r, hi, _mm256_cmpgt_epi32(bucket, gmax));
+
+            r = _mm256_permute4x64_epi64(_mm256_packs_epi32(r, r), 0x08);
+            _mm_storeu_si128((__m128i*)(out + i), _mm256_castsi256_si128(r));
+        }
+#else
+        const __m128i mask = _mm_set1_epi32(TP::maxResidue());
+        const __m128i gmax = _mm_set1_epi32(last - 1);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = _mm_set1_epi32(table[0]);
+        const __m128i hi = _mm_set1_epi32(table[last]);
+        const __m128 div = _mm_set1_ps(TP::maxResidue());
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128i v = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)(counts + i)), zero);
+            __m128i bucket = _mm_srli_epi32(v, RESIDUEBITS);
+            __m128i residue = _mm_and_si128(v, mask);
+
+            // no gather on SSE2, so pick up the neighbours by hand
+            int b[4];
+            for (int k = 0; k < 4; ++k)
+            {
+                b[k] = counts[i + k] >> RESIDUEBITS;
+                b[k] = b[k] < last ? b[k] : last - 1;
+            }
+            __m128i lv = _mm_setr_epi32(table[b[0]], table[b[1]], table[b[2]], table[b[3]]);
+            __m128i hv = _mm_setr_epi32(table[b[0] + 1], table[b[1] + 1], table[b[2] + 1], table[b[3] + 1]);
+            __m128i diff = _mm_sub_epi32(hv, lv);
+
+            // SSE2 has no 32 bit mullo; the product is exact in float anyway
+            __m128 prod = _mm_mul_ps(_mm_cvtepi32_ps(residue), _mm_cvtepi32_ps(diff));
+            __m128i r = _mm_add_epi32(lv, _mm_cvttps_epi32(_mm_div_ps(prod, div)));
+
+            __m128i isLo = _mm_cmpeq_epi32(bucket, zero);
+            __m128i isHi = _mm_cmpgt_epi32(bucket, gmax);
+            r = _mm_or_si128(_mm_andnot_si128(isLo, r), _mm_and_si128(isLo, lo));
+            r = _mm_or_si128(_mm_andnot_si128(isHi, r), _mm_and_si128(isHi, hi));
+
+            _mm_storel_epi64((__m128i*)(out + i), _mm_packs_epi32(r, r));
+        }
+#endif
+        return i;
+    }
+    //---------------------------------------------------------
+};
+#endif
+
+#endif
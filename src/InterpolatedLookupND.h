@@ -0,0 +1,240 @@
+/** @file
+    N dimensional interpolated lookup, one partitioner per axis.
+
+    The table is row major over the axes in the order given, so for
+    InterpolatedLookupND<int16_t, float, PT, PH> entry [t][h] is at
+    t * PH::tableSize() + h. Each axis is the same BitPartitioner,
+    ScaledPartitioner or ScaledOffsetPartitioner the 1D lookups use, so
+    a partitioner optimisation lands here too.
+
+    The 2^N corner interpolation is unrolled at compile time: the last
+    axis first, then each earlier one between the results, which is the
+    order HS1101::computeRH() goes in (along the row, then between
+    rows). An axis whose residue is 0 doesn't read its upper half at all.
+    Differences are divided by the axis step (maxResidue() + 1) with
+    ConstDivider, truncating as C does; an axis whose partitioner has
+    `static const bool floors = true` (a power of two step) shifts
+    instead, flooring as HS1101's pow2 grids do (HS1101Lookup.h).
+
+    An input at or past either end of an axis is clamped to that end
+    and flagged in LookupStatus, per axis, as HS1101 reports TempLow /
+    TempHigh:
+
+        typedef ScaledOffsetPartitioner<int16_t, 13, 1270, -1270> Temp;
+        typedef ScaledOffsetPartitioner<uint16_t, 24, 100, 8500> Counts;
+        InterpolatedLookupND<int16_t, float, Temp, Counts> rh(table, 256);
+        LookupStatus s;
+        int16_t v = rh.rawAt(s, tempRaw, counts);
+        if (s.high & 1) ... // temperature past the last row
+
+    3D and up work the same way, e.g. an RH table with a supply voltage
+    axis.
+ */
+#ifndef INTERPOLATED_LOOKUP_ND_H
+#define INTERPOLATED_LOOKUP_ND_H
+
+#include <stdint.h>
+#include "ConstDivider.h"
+#include "InterpolatedLookup.h"
+
+//-----------------------------------------------
+/// Axes clamped by a lookup, bit k for axis k
+struct LookupStatus
+{
+    uint8_t low;        ///< input at or below the first entry
+    uint8_t high;       ///< input at or above the last entry
+
+    bool ok() const { return !(low | high); }
+};
+
+//-----------------------------------------------
+//-----------------------------------------------
+/// Entries spanned by one step of the first axis: the product of the other sizes
+template<typename... TP>
+struct LookupNDStride
+{
+    static constexpr uint32_t value = 1;
+};
+
+template<typename P0, typename... TP>
+struct LookupNDStride<P0, TP...>
+{
+    static constexpr uint32_t value = uint32_t(P0::tableSize()) * LookupNDStride<TP...>::value;
+};
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Clamp and partition axes K.. of an input.
+    @return offset of the lower corner in the table
+ */
+template<unsigned K, typename... TP>
+struct LookupNDPartition
+{
+    static uint32_t run(const int32_t*, int32_t*, LookupStatus&) { return 0; }
+};
+
+template<unsigned K, typename P0, typename... TP>
+struct LookupNDPartition<K, P0, TP...>
+{
+    static_assert(P0::tableSize() >= 2, "an axis needs two entries to interpolate between");
+
+    static uint32_t run(const int32_t* v, int32_t* res, LookupStatus& s)
+    {
+        const int32_t step = int32_t(P0::maxResidue()) + 1;
+        const int32_t lo = P0::offset();
+        const int32_t hi = lo + int32_t(P0::tableSize() - 1) * step;
+
+        uint32_t bucket;
+        if (v[K] <= lo)
+        {
+            bucket = 0;
+            res[K] = 0;
+            s.low |= uint8_t(1) << K;
+        }
+        else if (v[K] >= hi)
+        {
+            // the last entry, as all of the last step
+            bucket = P0::tableSize() - 2;
+            res[K] = step;
+            s.high |= uint8_t(1) << K;
+        }
+        else
+        {
+            typename P0::index_t b, r;
+            P0::partition(typename P0::index_t(v[K]), b, r);
+            bucket = b;
+            res[K] = r;
+        }
+        return bucket * LookupNDStride<TP...>::value + LookupNDPartition<K + 1, TP...>::run(v, res, s);
+    }
+};
+
+//-----------------------------------------------
+/// Does axis P floor its interpolation steps; P::floors if it has one
+template<typename P, typename = void>
+struct LookupNDFloors
+{
+    static const bool value = false;
+};
+
+template<typename P>
+struct LookupNDFloors<P, decltype(void(P::floors))>
+{
+    static const bool value = P::floors;
+};
+
+//-----------------------------------------------
+//-----------------------------------------------
+/// Interpolate axes K.. from the lower corner at cell
+template<typename TT, unsigned K, typename... TP>
+struct LookupNDInterpolate
+{
+    static TT run(const TT* cell, const int32_t*) { return *cell; }
+};
+
+template<typename TT, unsigned K, typename P0, typename... TP>
+struct LookupNDInterpolate<TT, K, P0, TP...>
+{
+    static const uint32_t step = uint32_t(P0::maxResidue()) + 1;
+    static const bool floors = LookupNDFloors<P0>::value;
+    static_assert(!floors || (step & (step - 1)) == 0, "a flooring axis shifts, so needs a power of two step");
+
+    /// Exact for any |diff * residue| a TT table has; with a residue up
+    /// to the step itself (clamped high), /1270 of an int16 difference is
+    /// past the split form's 48 bits, so it takes the long one
+    typedef ConstDivider<
+        step,
+        sizeof(TT) <= 2 ? step * ((uint32_t(1) << (8 * sizeof(TT))) - 1) : 0x7fffffff
+    > divider_t;
+    static_assert(sizeof(TT) > 2 || floors || divider_t::isPow2() || divider_t::isNarrow()
+        || divider_t::isSplit() || divider_t::isLong(), "interpolation would need a 64 bit multiply");
+
+    /// One step's worth of n, truncated or floored
+    static int32_t divide(int32_t n)
+    {
+        return floors ? n >> __builtin_ctz(step) : divider_t::divSigned(n);
+    }
+
+    static TT run(const TT* cell, const int32_t* res)
+    {
+        TT v0 = LookupNDInterpolate<TT, K + 1, TP...>::run(cell, res);
+        if (res[K] == 0)
+            return v0;
+        TT v1 = LookupNDInterpolate<TT, K + 1, TP...>::run(cell + LookupNDStride<TP...>::value, res);
+        return TT(v0 + divide(int32_t(v1 - v0) * res[K]));
+    }
+};
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam TT Table intrinsic type
+    @tparam TR Table real type
+    @tparam TP Partitioner per axis, first axis slowest
+ */
+template<typename TT, typename TR, typename... TP>
+class InterpolatedLookupND
+{
+    static_assert(sizeof...(TP) >= 1 && sizeof...(TP) <= 8, "1 to 8 axes");
+
+protected:
+    const TT* _table;
+    const TR _scale;
+    const float _scaleFactor;
+
+public:
+    typedef TT table_t;
+    static const unsigned dims = sizeof...(TP);
+
+    //----------------------------------------------------------
+    /// Entries in the table
+    static constexpr uint32_t tableSize() { return LookupNDStride<TP...>::value; }
+    //----------------------------------------------------------
+    constexpr InterpolatedLookupND(const TT* table, TR scale)
+        :   _table(table),
+            _scale(scale),
+            _scaleFactor(1.0 / scale)
+    {}
+    //----------------------------------------------------------
+    const TT* table() const { return _table; }
+    TR getScale() const { return _scale; }
+    float getScaleFactor() const { return _scaleFactor; }
+    //----------------------------------------------------------
+    /**
+        Interpolated value, table units.
+        @param v        One input per axis
+        @param[out] s   Axes clamped
+     */
+    TT raw(const int32_t* v, LookupStatus& s) const
+    {
+        return rawFrom(_table, v, s);
+    }
+    //----------------------------------------------------------
+    /// raw() with the inputs as arguments
+    template<typename... V>
+    TT rawAt(LookupStatus& s, V... v) const
+    {
+        static_assert(sizeof...(V) == dims, "one input per axis");
+        const int32_t in[] = { int32_t(v)... };
+        return rawFrom(_table, in, s);
+    }
+    //----------------------------------------------------------
+    /// raw() for any table of this shape
+    static TT rawFrom(const TT* table, const int32_t* v, LookupStatus& s)
+    {
+        int32_t res[dims];
+        s.low = s.high = 0;
+        uint32_t at = LookupNDPartition<0, TP...>::run(v, res, s);
+        return LookupNDInterpolate<TT, 0, TP...>::run(table + at, res);
+    }
+    //----------------------------------------------------------
+    /// Interpolated value, real units
+    TR value(const int32_t* v, LookupStatus& s) const
+    {
+        return raw(v, s) * _scaleFactor;
+    }
+    //----------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,144 @@
+/** @file
+    1D lookup over an interleaved {base, slope} table.
+
+    Each entry carries its value and the step to the next entry, already
+    divided by the residue range and held with SLOPEBITS fraction bits,
+    so a lookup is one entry load plus a multiply, add and shift; no
+    subtract and no divide. It costs twice the flash of the plain table
+    and rounds the slope, so results can differ from
+    InterpolatedLookup1D::raw() by a count or so in table units.
+
+    Tables come from thermgen.py (TabGen(..., layout="slope")) or
+    hs1101.py (Generator(slopeLayout=True)).
+ */
+#ifndef INTERPOLATED_SLOPE_LOOKUP_H
+#define INTERPOLATED_SLOPE_LOOKUP_H
+
+#include <stdint.h>
+#include "InterpolatedLookup.h"
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    One table entry; value at the bucket start and the per-count slope,
+    scaled by 2^SLOPEBITS.
+ */
+template<typename TT>
+struct alignas(2 * sizeof(TT)) SlopeEntry
+{
+    TT base;
+    TT slope;
+};
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    1D lookup over a SlopeEntry table.
+
+    @tparam TT          Table intrinsic type
+    @tparam TR          Table real type
+    @tparam TP          Partitioner type
+    @tparam SLOPEBITS   Fraction bits in the slopes
+ */
+template<typename TT, typename TR, typename TP, unsigned SLOPEBITS>
+class InterpolatedSlopeLookup1D
+    : public LookupBase< InterpolatedSlopeLookup1D<TT, TR, TP, SLOPEBITS> >
+{
+protected:
+    const SlopeEntry<TT>* _table;
+    const TR _scale;
+    const float _scaleFactor;
+public:
+    typedef TT table_t;
+    typedef TP partitioner_t;
+    //----------------------------------------------------------
+    constexpr InterpolatedSlopeLookup1D(
+        const SlopeEntry<TT>* table,
+        TR scale
+    )
+        :  _table(table),
+           _scale(scale),
+           _scaleFactor(1.0/scale)
+    {}
+    //----------------------------------------------------------
+    /// Get raw value in first entry - lower limit of reasonably accurate values
+    TT loRaw() const { return _table[0].base; }
+    //----------------------------------------------------------
+    /// Get raw value in last entry - upper limit of reasonably accurate values
+    TT hiRaw() const { return _table[TP::tableSize() - 1].base; }
+    //----------------------------------------------------------
+    TR getScale() const { return _scale; }
+    //----------------------------------------------------------
+    float getScaleFactor() const { return _scaleFactor; }
+    //----------------------------------------------------------
+    TR scale(TT tv) const { return _scale * tv; }
+    //----------------------------------------------------------
+    TR lo() const { return scale(loRaw()); }
+    //----------------------------------------------------------
+    TR hi() const { return scale(hiRaw()); }
+    //----------------------------------------------------------
+    /**
+        Get the raw value for a given count.
+        @param count ADC counts
+        @return Interpolated value in table units
+     */
+    TT raw(typename TP::index_t count) const
+    {
+        typename TP::index_t bucket, residue;
+
+        TP::partition(count, bucket, residue);
+
+        if (bucket < 1)
+            return loRaw();
+
+        if (bucket >= TP::tableSize() - 1)
+            return hiRaw();
+
+        const SlopeEntry<TT> e = _table[bucket];
+        return e.base + ((int32_t(e.slope) * residue + (1 << SLOPEBITS >> 1)) >> SLOPEBITS);
+    }
+    //----------------------------------------------------------
+    /**
+        Get the scaled value for a given count.
+        @param count ADC counts
+        @return Scaled value
+     */
+    TR value(uint16_t count) const
+    {
+        return scale(raw(count));
+    }
+    //----------------------------------------------------------
+};
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Slope lookup with a table built around a number of bits; the
+    counterpart of InterpolatedLookup1DBits.
+ */
+template<typename TT, typename TR, unsigned TOTALBITS, unsigned RESIDUEBITS, unsigned SLOPEBITS>
+class InterpolatedSlopeLookup1DBits
+    : public InterpolatedSlopeLookup1D<
+    TT,
+    TR,
+    BitPartitioner<uint16_t, TOTALBITS, RESIDUEBITS>,
+    SLOPEBITS
+    >
+{
+    typedef InterpolatedSlopeLookup1D<
+        TT,
+        TR,
+        BitPartitioner<uint16_t, TOTALBITS, RESIDUEBITS>,
+        SLOPEBITS
+    > base_t;
+
+public:
+    //----------------------------------------------------------
+    constexpr InterpolatedSlopeLookup1DBits(
+        const SlopeEntry<TT>* table,
+        TR scale
+    )
+        : base_t(table, scale)
+    {}
+    //----------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,151 @@
+/** @file
+    1D lookup over non-uniformly spaced knots.
+
+    A thermistor curve is flat in the middle and steep at the ends, so
+    a uniform grid has entries to spare in the middle and too few at the
+    ends. Here the generator places each knot as far from the last as it
+    can while keeping the interpolation error under a tolerance, so the
+    knots bunch up only where the curve needs them.
+
+    Finding the knot is a small uniform index over the input (one byte
+    per cell, giving the last knot at or below the cell start) followed
+    by a fixed number of branchless compares, STEPS being the most knots
+    any one cell holds. Each knot carries its per-count slope, as in
+    InterpolatedSlopeLookup1D, so there is no divide.
+
+    The trade is speed for error per byte. In bench/BenchKnot.cpp (host,
+    -O2) 32 knots in 224 bytes hold 0.1C worst case where a 512 byte
+    uniform table is over 1C out, but a lookup costs 3-4x a uniform one
+    (12.9 against 3.25 ns, 13.7 against 4.7 ns on another run): the
+    STEPS compares and the wider entries are on top of the index load.
+    Use it where flash or accuracy is short, not for speed.
+
+    Tables come from thermgen.py (TabGen(..., layout="knots")).
+ */
+#ifndef KNOT_LOOKUP_H
+#define KNOT_LOOKUP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "InterpolatedLookup.h"
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    One knot; input count, value there, and the per-count slope to the
+    next knot scaled by 2^SLOPEBITS.
+ */
+template<typename TT>
+struct KnotEntry
+{
+    uint16_t count;
+    TT base;
+    TT slope;
+};
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam TT          Table intrinsic type
+    @tparam TR          Table real type
+    @tparam BITS        Input bits
+    @tparam KNOTS       Number of knots
+    @tparam INDEXBITS   log2 of index cells
+    @tparam STEPS       Most knots in any one index cell
+    @tparam SLOPEBITS   Fraction bits in the slopes
+ */
+template<typename TT, typename TR, unsigned BITS, unsigned KNOTS, unsigned INDEXBITS,
+         unsigned STEPS, unsigned SLOPEBITS>
+class KnotLookup1D
+    : public LookupBase< KnotLookup1D<TT, TR, BITS, KNOTS, INDEXBITS, STEPS, SLOPEBITS> >
+{
+    static_assert(KNOTS >= 2 && KNOTS <= 256, "index entries are one byte");
+    static_assert(INDEXBITS <= BITS, "more index cells than counts");
+
+protected:
+    const KnotEntry<TT>* _knots;
+    const uint8_t* _index;
+    const TR _scale;
+    const float _scaleFactor;
+public:
+    typedef TT table_t;
+    typedef uint16_t index_t;
+    //----------------------------------------------------------
+    static constexpr unsigned knots() { return KNOTS; }
+    //----------------------------------------------------------
+    /// Knot and index memory, for comparing against the uniform layouts
+    static constexpr size_t tableBytes()
+    {
+        return KNOTS * sizeof(KnotEntry<TT>) + (size_t(1) << INDEXBITS);
+    }
+    //----------------------------------------------------------
+    constexpr KnotLookup1D(
+        const KnotEntry<TT>* knots,
+        const uint8_t* index,
+        TR scale
+    )
+        :  _knots(knots),
+           _index(index),
+           _scale(scale),
+           _scaleFactor(1.0/scale)
+    {}
+    //----------------------------------------------------------
+    /// Get raw value at the first knot; lower counts clamp to this
+    TT loRaw() const { return _knots[0].base; }
+    //----------------------------------------------------------
+    /// Get raw value at the last knot; higher counts clamp to this
+    TT hiRaw() const { return _knots[KNOTS - 1].base; }
+    //----------------------------------------------------------
+    const KnotEntry<TT>* table() const { return _knots; }
+    //----------------------------------------------------------
+    TR getScale() const { return _scale; }
+    //----------------------------------------------------------
+    float getScaleFactor() const { return _scaleFactor; }
+    //----------------------------------------------------------
+    TR scale(TT tv) const { return _scale * tv; }
+    //----------------------------------------------------------
+    TR lo() const { return scale(loRaw()); }
+    //----------------------------------------------------------
+    TR hi() const { return scale(hiRaw()); }
+    //----------------------------------------------------------
+    /**
+        Get the raw value for a given count.
+        @param count ADC counts
+        @return Interpolated value in table units
+     */
+    TT raw(index_t count) const
+    {
+        if (count <= _knots[0].count)
+            return loRaw();
+
+        if (count >= _knots[KNOTS - 1].count)
+            return hiRaw();
+
+        // The knots are sorted, so the ones at or below count are the
+        // first few after the cell's; the compares are independent of
+        // each other. Past the end reads the last knot, which is above
+        // count and adds nothing.
+        const unsigned cell = _index[count >> (BITS - INDEXBITS)];
+        unsigned i = cell;
+        for (unsigned s = 1; s <= STEPS; ++s)
+        {
+            unsigned k = cell + s < KNOTS ? cell + s : KNOTS - 1;
+            i += _knots[k].count <= count;
+        }
+
+        const KnotEntry<TT> e = _knots[i];
+        return e.base + ((int32_t(e.slope) * (count - e.count) + (1 << SLOPEBITS >> 1)) >> SLOPEBITS);
+    }
+    //----------------------------------------------------------
+    /**
+        Get the scaled value for a given count.
+        @param count ADC counts
+        @return Scaled value
+     */
+    TR value(uint16_t count) const
+    {
+        return scale(raw(count));
+    }
+    //----------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,45 @@
+/** @file
+    Oversampled ADC arithmetic.
+
+    The thermistor ADC runs through the humidity gate, triggered from
+    the RTC PIT, and its ISR sums the conversions; a 1s gate at 512Hz is
+    ~512 samples. The mean of N samples averages white noise down by
+    sqrt(N), and with noise of a count or so to dither the input, each
+    4x gives another bit, so the sum is worth up to ~4 extra bits here.
+
+    mean() takes the sum back to a single conversion's scale, with
+    extra bits of fraction if asked for, so the thermistor tables index
+    it unchanged (or as ADCBITS + extraBits tables). Kept free of the
+    AVR headers so the host can run the same maths (bench/SimHumid.cpp).
+ */
+#ifndef OVERSAMPLE_H
+#define OVERSAMPLE_H
+
+#include <stdint.h>
+
+//-----------------------------------------------
+//-----------------------------------------------
+struct Oversample
+{
+    /// sum << extraBits stays in 32 bits for up to 65535 10 bit conversions
+    static const uint8_t maxExtraBits = 6;
+
+    //---------------------------------------------------------
+    /**
+        Mean of the samples, rounded.
+        @param sum          Conversions added up
+        @param samples      How many
+        @param extraBits    Fraction bits to keep, up to maxExtraBits
+        @return the mean * 2^extraBits, 0 if there were no samples
+     */
+    static uint16_t mean(uint32_t sum, uint16_t samples, uint8_t extraBits = 0)
+    {
+        if(samples == 0)
+            return 0;
+        if(extraBits > maxExtraBits)
+            extraBits = maxExtraBits;
+        return uint16_t(((sum << extraBits) + samples / 2) / samples);
+    }
+};
+
+#endif
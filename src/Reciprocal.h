@@ -0,0 +1,51 @@
+/** @file
+    Reciprocal (period) counting arithmetic.
+
+    Gated counting takes the oscillator edges in a 1s window, so a
+    reading is 1s awake and resolves 1 count in ~10,000. Timing N whole
+    oscillator periods against the main clock instead resolves one clock
+    tick in N * fclk / fosc, e.g. 1 in 128,000 for N = 64 at 10kHz on
+    20MHz, in 6.4ms.
+
+    counts() turns the period measurement back into what a 1s gate
+    would have counted, so the HS1101 tables index it unchanged.
+    Kept free of the AVR headers so the host can run the same maths
+    (bench/BenchReciprocal.cpp).
+ */
+#ifndef RECIPROCAL_H
+#define RECIPROCAL_H
+
+#include <stdint.h>
+
+//-----------------------------------------------
+//-----------------------------------------------
+struct ReciprocalCount
+{
+    /// N * fclk stays in 32 bits up to a 33MHz clock
+    static const uint8_t maxPeriods = 128;
+
+    //---------------------------------------------------------
+    /**
+        Edges a 1s gate would count, rounded.
+        @param periods  Whole oscillator periods timed
+        @param ticks    Main clock ticks they took
+        @param clkHz    Main clock
+        @return counts, 0 if nothing was timed
+     */
+    static uint32_t counts32(uint8_t periods, uint32_t ticks, uint32_t clkHz)
+    {
+        if(ticks == 0)
+            return 0;
+        return (periods * clkHz + ticks / 2) / ticks;
+    }
+    //---------------------------------------------------------
+    /// counts32(), saturated at 0xffff for 16 bit tables
+    static uint16_t counts(uint8_t periods, uint32_t ticks, uint32_t clkHz)
+    {
+        uint32_t c = counts32(periods, ticks, clkHz);
+        return c > 0xffff ? 0xffff : uint16_t(c);
+    }
+    //---------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,92 @@
+/** @file
+    Lock free single producer / single consumer ring, for an ISR handing
+    samples to the main loop on a single core.
+
+    The producer only writes _head and the consumer only _tail, each a
+    byte so the AVR reads and writes it in one go; neither side ever
+    needs interrupts off. A compiler barrier keeps an item's store
+    ahead of the index that publishes it. That's enough on one core;
+    it isn't a cross thread queue on the host.
+
+    When full, push() drops the new item and counts it, rather than
+    overwriting the oldest, which would move the consumer's index from
+    the producer's side.
+ */
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam T   Item type
+    @tparam N   Capacity, a power of two up to 128
+ */
+template<typename T, uint8_t N>
+class SpscRing
+{
+    static_assert(N >= 2 && N <= 128 && (N & (N - 1)) == 0, "N must be a power of two, 2..128");
+
+    T _items[N];
+    volatile uint8_t _head;         ///< next to write; free running
+    volatile uint8_t _tail;         ///< next to read; free running
+    volatile uint8_t _dropped;      ///< pushes refused while full, saturating
+
+    static void barrier() { __asm__ __volatile__("" ::: "memory"); }
+
+public:
+    //---------------------------------------------------------
+    SpscRing()
+        :   _head(0),
+            _tail(0),
+            _dropped(0)
+    {}
+    //---------------------------------------------------------
+    static constexpr uint8_t capacity() { return N; }
+    //---------------------------------------------------------
+    /// Producer side. @return false, and the item dropped, if full
+    bool push(const T& v)
+    {
+        uint8_t h = _head;
+        if(uint8_t(h - _tail) == N)
+        {
+            if(_dropped != 0xff)
+                _dropped = _dropped + 1;
+            return false;
+        }
+        _items[h & (N - 1)] = v;
+        barrier();
+        _head = h + 1;
+        return true;
+    }
+    //---------------------------------------------------------
+    /// Consumer side. @return false if empty
+    bool pop(T& v)
+    {
+        uint8_t t = _tail;
+        if(t == _head)
+            return false;
+        barrier();
+        v = _items[t & (N - 1)];
+        barrier();
+        _tail = t + 1;
+        return true;
+    }
+    //---------------------------------------------------------
+    /// Items waiting; either side
+    uint8_t size() const { return uint8_t(_head - _tail); }
+    //---------------------------------------------------------
+    /// Items dropped since the last reset()
+    uint8_t dropped() const { return _dropped; }
+    //---------------------------------------------------------
+    /// Empty it; only while the producer is stopped
+    void reset()
+    {
+        _tail = _head;
+        _dropped = 0;
+    }
+    //---------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,136 @@
+/** @file
+    Steinhart-Hart thermistor model,
+
+        1/T = a + b ln(R) + c ln(R)^3       (T in K)
+
+    The Beta equation is the c = 0 case (fromBeta()); the cubic term is
+    what keeps a real part's curve within a few hundredths of a degree
+    far from 25C, where Beta drifts by tenths. Coefficients come from a
+    datasheet or from fit() over three or more measured points:
+
+        const double t[] = { -20, 25, 85 };
+        const double r[] = { 1055000, 100000, 10440 };
+        SteinhartHart<double> sh;
+        if (SteinhartHart<double>::fit(t, r, 3, sh))
+            ...
+
+    An all zero model (isSet() false) is how Thermistor and friends say
+    "use the Beta equation instead".
+
+    @tparam F   float on the target, double in the generators
+ */
+#ifndef STEINHART_HART_H
+#define STEINHART_HART_H
+
+#include <math.h>
+#include <stdint.h>
+
+template<typename F = float>
+struct SteinhartHart
+{
+    F a;
+    F b;
+    F c;
+
+    //----------------------------------------------------------
+    bool isSet() const { return b != 0; }
+
+    //----------------------------------------------------------
+    /// The Beta equation through rth at t0 C
+    static SteinhartHart fromBeta(F rth, F beta, F t0 = 25)
+    {
+        return SteinhartHart{ F(1) / (t0 + F(273.15)) - F(log(rth)) / beta, F(1) / beta, 0 };
+    }
+    //----------------------------------------------------------
+    /// 1/T, 1/K
+    F invTemp(F r) const
+    {
+        F l = log(r);
+        return a + (b + c * l * l) * l;
+    }
+    //----------------------------------------------------------
+    /// Temperature, C
+    F tempFromResistance(F r) const
+    {
+        return F(1) / invTemp(r) - F(273.15);
+    }
+    //----------------------------------------------------------
+    /// Resistance at a temperature, C; the depressed cubic in ln(R), solved in closed form
+    F resistanceAtTemp(F t) const
+    {
+        F y = (a - F(1) / (t + F(273.15)));
+        if (c == 0)
+            return exp(-y / b);
+
+        y /= c;
+        F p = b / (3 * c);
+        F x = sqrt(p * p * p + y * y / 4);
+        return exp(cbrt(x - y / 2) - cbrt(x + y / 2));
+    }
+    //----------------------------------------------------------
+    /**
+        Least squares fit to n >= 3 (temperature C, resistance) points;
+        exact through three. Solved on ln(R) scaled by its mean, which
+        keeps the normal equations well conditioned.
+        @return false if there are too few points or they don't pin the
+                model down (e.g. repeated resistances)
+     */
+    static bool fit(const F* tempC, const F* ohms, uint8_t n, SteinhartHart& out)
+    {
+        if (n < 3)
+            return false;
+
+        F m = 0;
+        for (uint8_t i = 0; i < n; ++i)
+            m += log(ohms[i]);
+        m /= n;
+
+        // normal equations for y = a + b' s + c' s^3, s = ln(R)/m
+        F A[3][4] = {};
+        for (uint8_t i = 0; i < n; ++i)
+        {
+            F s = log(ohms[i]) / m;
+            F v[3] = { 1, s, s * s * s };
+            F y = F(1) / (tempC[i] + F(273.15));
+            for (uint8_t r = 0; r < 3; ++r)
+            {
+                for (uint8_t k = 0; k < 3; ++k)
+                    A[r][k] += v[r] * v[k];
+                A[r][3] += v[r] * y;
+            }
+        }
+
+        // Gaussian elimination, partial pivoting
+        for (uint8_t col = 0; col < 3; ++col)
+        {
+            uint8_t piv = col;
+            for (uint8_t r = col + 1; r < 3; ++r)
+                if (fabs(A[r][col]) > fabs(A[piv][col]))
+                    piv = r;
+            if (fabs(A[piv][col]) <= F(1e-12) * fabs(A[0][0]))
+                return false;
+            for (uint8_t k = 0; k < 4; ++k)
+            {
+                F t = A[col][k];
+                A[col][k] = A[piv][k];
+                A[piv][k] = t;
+            }
+            for (uint8_t r = 0; r < 3; ++r)
+            {
+                if (r == col)
+                    continue;
+                F f = A[r][col] / A[col][col];
+                for (uint8_t k = col; k < 4; ++k)
+                    A[r][k] -= f * A[col][k];
+            }
+        }
+
+        out.a = A[0][3] / A[0][0];
+        out.b = A[1][3] / A[1][1] / m;
+        out.c = A[2][3] / A[2][2] / (m * m * m);
+        return out.b > 0;
+    }
+    //----------------------------------------------------------
+};
+
+#endif
@@ -0,0 +1,98 @@
+
+/**
+ @file
+   AUTOGENERATED Thermistor table, non-uniform knots
+
+   Rth          = 100.00k
+   B            = 3950
+   Rload        = 100.00k
+   Inverted     = False
+   ADC bits     = 10
+   Range        = -40C to 125C
+   Tolerance    = 0.1C
+   Knots        = 32
+   Index bits   = 5
+   Slope bits   = 7
+   Temp Scaled  = x128
+ */
+
+
+#include "TempTable100kB3950x128Knots.h"
+
+
+const KnotEntry<int16_t> TempTable100kB3950x128Knots::_knots[] = {
+  {    25,    -5107,   8302 }, // #0 t=-39.91C
+  {    32,    -4653,   6741 }, // #1 t=-36.36C
+  {    41,    -4179,   5472 }, // #2 t=-32.65C
+  {    53,    -3666,   4446 }, // #3 t=-28.65C
+  {    68,    -3145,   3658 }, // #4 t=-24.57C
+  {    87,    -2602,   3029 }, // #5 t=-20.33C
+  {   111,    -2034,   2543 }, // #6 t=-15.90C
+  {   141,    -1438,   2153 }, // #7 t=-11.24C
+  {   180,     -782,   1844 }, // #8 t=-6.12C
+  {   232,      -33,   1613 }, // #9 t=-0.26C
+  {   300,      824,   1457 }, // #10 t=6.44C
+  {   408,     2053,   1433 }, // #11 t=16.04C
+  {   557,     3721,   1564 }, // #12 t=29.07C
+  {   635,     4674,   1747 }, // #13 t=36.51C
+  {   695,     5493,   1980 }, // #14 t=42.91C
+  {   744,     6251,   2266 }, // #15 t=48.84C
+  {   784,     6959,   2605 }, // #16 t=54.37C
+  {   818,     7651,   3013 }, // #17 t=59.78C
+  {   846,     8310,   3467 }, // #18 t=64.92C
+  {   869,     8933,   4023 }, // #19 t=69.79C
+  {   890,     9593,   4686 }, // #20 t=74.94C
+  {   908,    10252,   5461 }, // #21 t=80.09C
+  {   923,    10892,   6370 }, // #22 t=85.10C
+  {   936,    11539,   7401 }, // #23 t=90.15C
+  {   947,    12175,   8590 }, // #24 t=95.12C
+  {   956,    12779,   9888 }, // #25 t=99.83C
+  {   964,    13397,  11447 }, // #26 t=104.67C
+  {   971,    14023,  13205 }, // #27 t=109.55C
+  {   977,    14642,  15155 }, // #28 t=114.39C
+  {   982,    15234,  17459 }, // #29 t=119.01C
+  {   987,    15916,  19200 }, // #30 t=124.35C
+  {   988,    16066,      0 }, // #31 t=125.52C
+
+};
+
+const uint8_t TempTable100kB3950x128Knots::_index[] = {
+    0, // c=0
+    1, // c=32
+    3, // c=64
+    5, // c=96
+    6, // c=128
+    7, // c=160
+    8, // c=192
+    8, // c=224
+    9, // c=256
+    9, // c=288
+   10, // c=320
+   10, // c=352
+   10, // c=384
+   11, // c=416
+   11, // c=448
+   11, // c=480
+   11, // c=512
+   11, // c=544
+   12, // c=576
+   12, // c=608
+   13, // c=640
+   13, // c=672
+   14, // c=704
+   14, // c=736
+   15, // c=768
+   16, // c=800
+   17, // c=832
+   18, // c=864
+   20, // c=896
+   22, // c=928
+   25, // c=960
+   30, // c=992
+
+
+};
+
+// static instance
+TempTable100kB3950x128Knots TempTable100kB3950x128Knots::_instance;
+
@@ -0,0 +1,36 @@
+
+/**
+ @file
+   AUTOGENERATED Thermistor table, non-uniform knots
+
+   Rth          = 100.00k
+   B            = 3950
+   Rload        = 100.00k
+   Inverted     = False
+   ADC bits     = 10
+   Range        = -40C to 125C
+   Tolerance    = 0.1C
+   Knots        = 32
+   Index bits   = 5
+   Slope bits   = 7
+   Temp Scaled  = x128
+ */
+#include "KnotLookup.h"
+
+class TempTable100kB3950x128Knots : public KnotLookup1D<int16_t, float, 10, 32, 5, 6, 7>
+{
+    typedef KnotLookup1D<int16_t, float, 10, 32, 5, 6, 7> Base;
+
+    static const KnotEntry<int16_t> _knots[];
+    static const uint8_t _index[];
+
+public:
+    TempTable100kB3950x128Knots() : Base(_knots, _index, 128)
+    {}
+
+    static TempTable100kB3950x128Knots _instance;
+
+};
+
+
+
@@ -0,0 +1,59 @@
+
+/**
+ @file
+   AUTOGENERATED Thermistor table, {base, slope} layout
+
+   Rth          = 100.00k
+   B            = 3950
+   Rload        = 100.00k
+   Inverted     = False
+   ADC bits     = 10
+   Table bits   = 5
+   Slope bits   = 8
+   Temp Scaled  = x128
+ */
+
+
+#include "TempTable100kB3950x128Slope.h"
+
+
+const SlopeEntry<int16_t> TempTable100kB3950x128Slope::_table[] = {
+  {    -5889,  10207 }, // #0 c=0
+  {    -4653,  11388 }, // #1 c=32
+  {    -3274,   7416 }, // #2 c=64
+  {    -2376,   5715 }, // #3 c=96
+  {    -1684,   4773 }, // #4 c=128
+  {    -1106,   4187 }, // #5 c=160
+  {     -599,   3782 }, // #6 c=192
+  {     -141,   3485 }, // #7 c=224
+  {      281,   3287 }, // #8 c=256
+  {      679,   3146 }, // #9 c=288
+  {     1060,   3039 }, // #10 c=320
+  {     1428,   2965 }, // #11 c=352
+  {     1787,   2932 }, // #12 c=384
+  {     2142,   2907 }, // #13 c=416
+  {     2494,   2923 }, // #14 c=448
+  {     2848,   2956 }, // #15 c=480
+  {     3206,   3006 }, // #16 c=512
+  {     3570,   3097 }, // #17 c=544
+  {     3945,   3204 }, // #18 c=576
+  {     4333,   3353 }, // #19 c=608
+  {     4739,   3534 }, // #20 c=640
+  {     5167,   3782 }, // #21 c=672
+  {     5625,   4088 }, // #22 c=704
+  {     6120,   4492 }, // #23 c=736
+  {     6664,   5021 }, // #24 c=768
+  {     7272,   5756 }, // #25 c=800
+  {     7969,   6780 }, // #26 c=832
+  {     8790,   8357 }, // #27 c=864
+  {     9802,  10958 }, // #28 c=896
+  {    11129,  16087 }, // #29 c=928
+  {    13077,  30084 }, // #30 c=960
+  {    16720,      0 }, // #31 c=992
+
+
+};
+
+// static instance
+TempTable100kB3950x128Slope TempTable100kB3950x128Slope::_instance;
+
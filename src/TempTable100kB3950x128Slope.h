@@ -0,0 +1,32 @@
+
+/**
+ @file
+   AUTOGENERATED Thermistor table, {base, slope} layout
+
+   Rth          = 100.00k
+   B            = 3950
+   Rload        = 100.00k
+   Inverted     = False
+   ADC bits     = 10
+   Table bits   = 5
+   Slope bits   = 8
+   Temp Scaled  = x128
+ */
+#include "InterpolatedSlopeLookup.h"
+
+class TempTable100kB3950x128Slope : public InterpolatedSlopeLookup1DBits<int16_t, float, 10, 5, 8>
+{
+    typedef InterpolatedSlopeLookup1DBits<int16_t,float, 10, 5, 8> Base;
+
+    static const SlopeEntry<int16_t> _table[];
+
+public:
+    TempTable100kB3950x128Slope() : Base(_table, 128)
+    {}
+
+    static TempTable100kB3950x128Slope _instance;
+
+};
+
+
+
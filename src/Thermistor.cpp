@@ -22,6 +22,7 @@
 #include "Thermistor.h"
 //#include "io.h"
 #include <math.h>
+#include <string.h>
 //#include <Print.h>
 #include <stdint.h>
 
@@ -42,7 +43,9 @@ Thermistor::Thermistor()
     _offset(0.0),
     _invert(false),
     _adcCountMax(1023),
-    _majick2(M2)
+    _majick2(M2),
+    _version(blobVersion),
+    _sh{0, 0, 0}
 {
 
 }
@@ -58,6 +61,9 @@ float Thermistor::voltsFromCounts(int c) const
 //----------------------------------------------------
 float Thermistor::tempFromResistance(float r) const
 {
+    if(_sh.isSet())
+        return _sh.tempFromResistance(r) + _offset;
+
     auto it = 1/(25+AZ) + log(r/_rth)/_beta;
     auto t = 1/it - AZ;
 #if TRACE
@@ -91,6 +97,26 @@ bool Thermistor::isOk() const
     return _majick1 == M1 && _majick2 == M2;
 }
 //----------------------------------------------------
+bool Thermistor::load(const void* blob, size_t size)
+{
+    Thermistor t;
+    if(size == sizeof(t))
+    {
+        memcpy(&t, blob, size);
+        if(t._version != blobVersion)
+            return false;
+    }
+    else if(size == sizeV1())
+        memcpy(&t, blob, size);     // the tail keeps its defaults
+    else
+        return false;
+
+    if(!t.isOk())
+        return false;
+    *this = t;
+    return true;
+}
+//----------------------------------------------------
 void Thermistor::dump(Print& out)
 {
     //out.printf("Rth=%f Beta=%f\r\n", _rth, _beta);
@@ -9,8 +9,15 @@
 #ifndef __THERMISTOR_H__
 #define __THERMISTOR_H__
 
+#include <stddef.h>
 #include <stdint.h>
+#include "SteinhartHart.h"
 
+/**
+ * Also the /cal.bin blob. The layout up to _majick2 is the original
+ * one; fields added since go after it, behind a version word, so a file
+ * saved by older firmware still loads (load()).
+ */
 struct Thermistor
 {
     uint32_t _majick1;
@@ -23,9 +30,24 @@ struct Thermistor
     bool _invert;
     int _adcCountMax;
     uint32_t _majick2;
+    // ---- version 1 blobs end here
+    uint32_t _version;          ///< blobVersion when the fields below are valid
+    SteinhartHart<float> _sh;   ///< used instead of _rth/_beta when set
+
+    static const uint32_t blobVersion = 2;
     
 	Thermistor();
 
+    /// Size of a blob saved before _version was added
+    static constexpr size_t sizeV1() { return offsetof(Thermistor, _version); }
+
+    /**
+     * Take a saved blob, of this version or version 1 (no Steinhart-Hart;
+     * Beta as before).
+     * @return isOk(); false leaves the defaults
+     */
+    bool load(const void* blob, size_t size);
+
     float voltsFromCounts(int c) const;
     float tempFromResistance(float v) const;
     float tempFromVolts(float v) const;
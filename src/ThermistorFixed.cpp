@@ -0,0 +1,160 @@
+/*
+* ThermistorFixed.cpp
+*
+* Integer only Beta equation, for MCUs without an FPU.
+
+  Non inverted (therm pulls up):
+
+      rth = Rl * (kc - c) / c        kc = adcCountMax * vDrive/vAdcMax
+
+  Inverted (therm pulls down):
+
+      rth = Rl * c / (kc - c)
+
+*/
+
+#include "ThermistorFixed.h"
+#include <math.h>
+#include <stdint.h>
+
+/// log2(1 + i/32), Q15
+static const uint16_t LOG2_TABLE[33] = {
+        0,  1455,  2866,  4236,  5568,  6863,  8124,  9352,
+    10549, 11716, 12855, 13968, 15055, 16117, 17156, 18173,
+    19168, 20143, 21098, 22034, 22952, 23852, 24736, 25604,
+    26455, 27292, 28114, 28922, 29717, 30498, 31267, 32024,
+    32768
+};
+
+/// 1/(0.5 + i/32), Q14
+static const uint16_t RECIP_TABLE[17] = {
+    32768, 30840, 29127, 27594, 26214, 24966, 23831, 22795,
+    21845, 20972, 20165, 19418, 18725, 18079, 17476, 16913,
+    16384
+};
+
+//----------------------------------------------------
+/// Leading zeros of a 32 bit value, whatever size long is
+static inline uint8_t clz32(uint32_t x)
+{
+    return __builtin_clzl(x) - (8 * sizeof(unsigned long) - 32);
+}
+//----------------------------------------------------
+ThermistorFixed::ThermistorFixed()
+{
+    calibrate(Thermistor());
+}
+//----------------------------------------------------
+ThermistorFixed::ThermistorFixed(const Thermistor& th, uint16_t scale)
+{
+    calibrate(th, scale);
+}
+//----------------------------------------------------
+void ThermistorFixed::calibrate(const Thermistor& th, uint16_t scale)
+{
+    const float AZ = 273.15;
+    const float LN2 = 0.69314718;
+    const float Q38 = 274877906944.0; // 2^38
+
+    _kc = lround(256.0 * th._adcCountMax * th._vDrive / th._vAdcMax);
+    if (th._sh.isSet())
+    {
+        // 1/T = A + B lr + C lr^3, lr = ln(Rl) + ln2 * log2(num/den)
+        const float lrl = log(th._rl);
+        const float a = th._sh.a, b = th._sh.b, c = th._sh.c;
+        _a = lround((a + b * lrl + c * lrl * lrl * lrl) * Q38);
+        _b = lround(LN2 * (b + 3 * c * lrl * lrl) * Q38);
+        _c2 = lround(3 * c * lrl * LN2 * LN2 * Q38);
+        _c3 = lround(c * LN2 * LN2 * LN2 * Q38);
+    }
+    else
+    {
+        _a = lround((1 / (25 + AZ) + log(th._rl / th._rth) / th._beta) * Q38);
+        _b = lround(LN2 / th._beta * Q38);
+        _c2 = 0;
+        _c3 = 0;
+    }
+    _offset = lround((th._offset - AZ) * 256);
+    _scale = scale;
+    _adcCountMax = th._adcCountMax;
+    _invert = th._invert;
+}
+//----------------------------------------------------
+int32_t ThermistorFixed::log2Q16(uint32_t x)
+{
+    uint8_t e = 31 - clz32(x);
+    uint32_t m = x << (31 - e);             // top bit set
+
+    uint8_t ix = (m >> 26) & 31;            // next 5 bits index the table
+    uint32_t frac = (m >> 10) & 0xffff;     // next 16 interpolate
+    uint16_t lo = LOG2_TABLE[ix];
+    uint16_t l = lo + (((LOG2_TABLE[ix + 1] - lo) * frac) >> 16);
+
+    return (int32_t(e) << 16) + (int32_t(l) << 1);
+}
+//----------------------------------------------------
+uint32_t ThermistorFixed::reciprocalQ38(uint32_t x)
+{
+    uint8_t sh = clz32(x);
+    uint32_t m = x << sh;                   // [0.5, 1) Q32
+
+    uint8_t ix = (m >> 27) & 15;
+    uint32_t frac = (m >> 11) & 0xffff;
+    uint16_t hi = RECIP_TABLE[ix];
+    uint32_t y = uint32_t(hi - (((hi - RECIP_TABLE[ix + 1]) * frac) >> 16)) << 16; // Q30, ~1e-3
+
+    // one Newton step, y *= 2 - m*y; ~1e-6
+    uint32_t p = (uint64_t(m) * y) >> 32;   // Q30
+    y = (uint64_t(y) * ((uint32_t(1) << 31) - p)) >> 30;
+
+    // 1/x = 2^(38+sh-32) / (m/2^32); in Q8 that is y * 2^(sh-16)
+    return sh <= 16 ? y >> (16 - sh) : y << (sh - 16);
+}
+//----------------------------------------------------
+int16_t ThermistorFixed::raw(uint16_t c) const
+{
+    if (c > _adcCountMax)
+        c = _adcCountMax;
+
+    int32_t num = _kc - (int32_t(c) << 8);
+    int32_t den = int32_t(c) << 8;
+    if (_invert)
+    {
+        int32_t t = num;
+        num = den;
+        den = t;
+    }
+
+    // open / short circuit
+    if (den <= 0)
+        return -RAW_MAX;
+    if (num <= 0)
+        return RAW_MAX;
+
+    int32_t l = log2Q16(num) - log2Q16(den);
+    int32_t it;
+    if (_c2 | _c3)
+    {
+        int64_t acc = _c3;
+        acc = _c2 + ((acc * l) >> 16);
+        acc = _b + ((acc * l) >> 16);
+        it = _a + int32_t((acc * l) >> 16);
+    }
+    else
+        it = _a + int32_t((int64_t(_b) * l) >> 16);
+    if (it <= 0)
+        return RAW_MAX;
+
+    int32_t t = int32_t(reciprocalQ38(it)) + _offset;     // C, Q8
+
+    // t * scale / 256, split so it can't overflow before saturating
+    int32_t whole = t >> 8;
+    if (whole >= RAW_MAX)
+        return RAW_MAX;
+    if (whole <= -RAW_MAX)
+        return -RAW_MAX;
+    int32_t v = whole * _scale + (((t & 255) * _scale + 128) >> 8);
+
+    return v > RAW_MAX ? RAW_MAX : v < -RAW_MAX ? -RAW_MAX : int16_t(v);
+}
+//----------------------------------------------------
@@ -0,0 +1,71 @@
+/*
+* ThermistorFixed.h
+*
+* Integer only Beta equation, for MCUs without an FPU.
+*/
+
+
+#ifndef __THERMISTOR_FIXED_H__
+#define __THERMISTOR_FIXED_H__
+
+#include <stdint.h>
+#include "InterpolatedLookup.h"
+#include "Thermistor.h"
+
+/**
+ * Beta equation in fixed point, driven by a Thermistor's calibration.
+ *
+ * The divider ratio is never divided out: rth/Rth is (Rl/Rth)*num/den
+ * with num and den straight from the counts, so
+ *
+ *     1/T = 1/T25 + ln(Rl/Rth)/B + ln2/B * (log2(num) - log2(den))
+ *
+ * With Steinhart-Hart coefficients set on the Thermistor, ln(rth) is
+ * ln(Rl) + ln2*log2(num/den) again, and expanding the cubic around ln(Rl)
+ * adds log2^2 and log2^3 terms (_c2, _c3), evaluated by Horner's rule.
+ *
+ * log2 is an exponent from the leading zero count plus a 33 entry
+ * interpolated table on the mantissa; 1/T is a Q38 integer and T comes
+ * back through a table seeded Newton reciprocal. calibrate() folds the
+ * float fields into integer constants once; raw() uses no float.
+ *
+ * Against the double Beta equation, a 100k/3950 thermistor on a 10 bit
+ * ADC is within 0.01C from -40C to 150C (bench/BenchFixed.cpp).
+ */
+class ThermistorFixed : public LookupBase<ThermistorFixed>
+{
+    int32_t _kc;        ///< full scale count * vDrive/vAdcMax, Q8
+    int32_t _a;         ///< 1/T25 + ln(Rl/Rth)/B, Q38
+    int32_t _b;         ///< ln2/B, Q38 per unit of log2
+    int32_t _c2;        ///< Steinhart-Hart, Q38 per log2^2; 0 for Beta
+    int32_t _c3;        ///< Steinhart-Hart, Q38 per log2^3; 0 for Beta
+    int32_t _offset;    ///< offset - 273.15, degrees Q8
+    uint16_t _scale;    ///< result is degrees C times this
+    uint16_t _adcCountMax;
+    bool _invert;
+
+public:
+    static const int16_t RAW_MAX = 32767;
+
+    ThermistorFixed();
+    explicit ThermistorFixed(const Thermistor& th, uint16_t scale = 128);
+
+    /// Recompute the constants after the thermistor's calibration changes
+    void calibrate(const Thermistor& th, uint16_t scale = 128);
+
+    /// Temperature in C times getScale(); saturates at +-RAW_MAX
+    int16_t raw(uint16_t c) const;
+
+    uint16_t getScale() const { return _scale; }
+    float getScaleFactor() const { return 1.0f / _scale; }
+    float value(uint16_t c) const { return raw(c) * getScaleFactor(); }
+
+    /// log2(x), Q16; x > 0
+    static int32_t log2Q16(uint32_t x);
+
+    /// 1/x for x in Q38, result in Q8; x > 0
+    static uint32_t reciprocalQ38(uint32_t x);
+
+}; //ThermistorFixed
+
+#endif //__THERMISTOR_FIXED_H__
@@ -6,14 +6,16 @@
 */
 
 
-#ifndef __THERMISTOR_H__
-#define __THERMISTOR_H__
+#ifndef __THERMISTOR_FLOAT_H__
+#define __THERMISTOR_FLOAT_H__
 
 #include <math.h>
 #include <stdint.h>
+#include "SteinhartHart.h"
 
 /**
- * Thermistor calculation based on float arithmetic.
+ * Thermistor calculation based on float arithmetic; Beta equation, or
+ * Steinhart-Hart if constructed with coefficients.
  */
 class ThermistorFloat
 {
@@ -23,23 +25,52 @@ class ThermistorFloat
     const float _offset;
     const bool _invert;
     const int _adcCountMax;
+    const SteinhartHart<float> _sh;
     const float  AZ = 273.15;
 
 public:
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 	ThermistorFloat()
         : 
-        _adcCountMax(1023),
-        _rl(10 * 1000),
         _rth(100 * 1000),
         _beta(3950),
+        _rl(10 * 1000),
         _offset(0.0),
-        _invert(false)
+        _invert(false),
+        _adcCountMax(1023),
+        _sh{0, 0, 0}
     {
     }
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    float tempFromResistance(float v) const
+    ThermistorFloat(float rth, float beta, float rl, bool invert = false, int adcCountMax = 1023)
+        :
+        _rth(rth),
+        _beta(beta),
+        _rl(rl),
+        _offset(0.0),
+        _invert(invert),
+        _adcCountMax(adcCountMax),
+        _sh{0, 0, 0}
     {
+    }
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    ThermistorFloat(const SteinhartHart<float>& sh, float rl, bool invert = false, int adcCountMax = 1023)
+        :
+        _rth(0),
+        _beta(0),
+        _rl(rl),
+        _offset(0.0),
+        _invert(invert),
+        _adcCountMax(adcCountMax),
+        _sh(sh)
+    {
+    }
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    float tempFromResistance(float r) const
+    {
+        if (_sh.isSet())
+            return _sh.tempFromResistance(r) + _offset;
+
         auto it = 1 / (25 + AZ) + log(r / _rth) / _beta;
         auto t = 1 / it - AZ;
         return t + _offset;
@@ -58,14 +89,19 @@ public:
         return tempFromResistance(rth);
     }
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifdef ARDUINO
     void dump(class Print& out) const
     {
-        out.printf("Rth=%f Beta=%f\r\n", _rth, _beta);
+        if (_sh.isSet())
+            out.printf("A=%e B=%e C=%e\r\n", _sh.a, _sh.b, _sh.c);
+        else
+            out.printf("Rth=%f Beta=%f\r\n", _rth, _beta);
         out.printf("Rload=%f Invert=%d\r\n", _rl, _invert);
-        out.printf("Vadc=%f Vdrive=%f offs=%fC\r\n", _vAdcMax, _vDrive, _offset);
+        out.printf("ADCmax=%d offs=%fC\r\n", _adcCountMax, _offset);
     }
+#endif
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 }; //Thermistor
 
-#endif //__THERMISTOR_H__
+#endif //__THERMISTOR_FLOAT_H__
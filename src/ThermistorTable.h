@@ -0,0 +1,235 @@
+/** @file
+    Compile time thermistor tables.
+
+    Builds the same int16_t table thermgen.py's TabGen.genTable() writes
+    out, but as a constant expression, so a new Rth/Beta/Rload/scale
+    combination is just another template instance:
+
+        typedef TempTable<100000, 3950, 100000, 10, 5, false, 128> Therm;
+        auto t = Therm::_instance.value(adc);
+
+    The table and the lookup instance are constant-initialised, so there
+    is no static initialisation at startup.
+
+    DirectTempTable is the one-entry-per-count version, and
+    TempTableFor<..., BUDGET> picks between the two by table size.
+
+    Needs C++14 constexpr; uses constinit where the compiler has it.
+ */
+#ifndef THERMISTOR_TABLE_H
+#define THERMISTOR_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "DirectLookup.h"
+#include "InterpolatedLookup.h"
+
+#if defined(__cpp_constinit)
+#define THERMISTOR_TABLE_CONSTINIT constinit
+#else
+#define THERMISTOR_TABLE_CONSTINIT
+#endif
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    constexpr maths for table generation; <math.h> isn't constexpr.
+ */
+struct ConstMath
+{
+    //---------------------------------------------------------
+    /// Natural log, full double precision for x > 0
+    static constexpr double log(double x)
+    {
+        const double LN2 = 0.69314718055994530942;
+        int k = 0;
+
+        // x = m * 2^k, m in [0.707, 1.414]
+        while (x > 1.4142135623730951) { x /= 2; ++k; }
+        while (x < 0.7071067811865476) { x *= 2; --k; }
+
+        // log(m) = 2 atanh((m-1)/(m+1)), |y| < 0.172
+        double y = (x - 1) / (x + 1);
+        double y2 = y * y;
+        double term = y;
+        double sum = 0;
+        for (int n = 1; n < 40; n += 2)
+        {
+            sum += term / n;
+            term *= y2;
+        }
+        return 2 * sum + k * LN2;
+    }
+    //---------------------------------------------------------
+};
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Beta equation table generator, a constexpr version of thermgen.py.
+
+    @tparam RTH         Thermistor resistance at 25C, ohms
+    @tparam BETA        Thermistor beta
+    @tparam RLOAD       Load resistor, ohms
+    @tparam ADCBITS     ADC resolution
+    @tparam TABLEBITS   log2 of table entries
+    @tparam INVERT      Thermistor is on the low side of the divider
+    @tparam TSCALE      Temperatures are stored multiplied by this
+    @tparam TT          Table type
+ */
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, unsigned TABLEBITS,
+         bool INVERT, unsigned TSCALE, typename TT = int16_t>
+struct ThermistorTableGen
+{
+    static constexpr unsigned residueBits = ADCBITS - TABLEBITS;
+    static constexpr unsigned tableSize = 1u << TABLEBITS;
+    static constexpr unsigned adcMax = (1u << ADCBITS) - 1;
+
+    struct Table
+    {
+        TT v[tableSize];
+    };
+
+    //---------------------------------------------------------
+    /// Temperature in C for a (fractional) ADC count
+    static constexpr double tempForCounts(double ac)
+    {
+        const double AZ = 273.15;
+        const double T1 = AZ + 25;
+
+        if (INVERT)
+            ac = adcMax - ac;
+
+        double vfrac = ac / adcMax;
+        double rth = RLOAD * (1 / vfrac - 1);
+        return 1 / (1 / T1 - ConstMath::log(double(RTH) / rth) / BETA) - AZ;
+    }
+    //---------------------------------------------------------
+    /**
+        Build the table. Entry 0 is computed at half a bucket, as the
+        count 0 entry would be infinite; like the first and last entries
+        in the generated files it is only there to clamp against. A full
+        scale count (direct tables only) is likewise taken half a count in,
+        and values saturate at the range of TT.
+     */
+    static constexpr Table generate()
+    {
+        Table t{};
+        const unsigned bucket = 1u << residueBits;
+        const double tmax = double((uint32_t(1) << (8 * sizeof(TT) - 1)) - 1);
+
+        for (unsigned i = 0; i < tableSize; ++i)
+        {
+            double temp = i == 0 ? tempForCounts(0.5 * bucket)
+                : i * bucket >= adcMax ? tempForCounts(adcMax - 0.5)
+                : tempForCounts(double(i * bucket));
+
+            // int(t*scale+0.5) as in TabGen, i.e. truncated toward zero
+            double v = temp * TSCALE + 0.5;
+            v = v > tmax ? tmax : v < -tmax ? -tmax : v;
+            t.v[i] = TT(int32_t(v));
+        }
+        return t;
+    }
+    //---------------------------------------------------------
+
+    static constexpr Table table = generate();
+};
+
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, unsigned TABLEBITS,
+         bool INVERT, unsigned TSCALE, typename TT>
+constexpr typename ThermistorTableGen<RTH, BETA, RLOAD, ADCBITS, TABLEBITS, INVERT, TSCALE, TT>::Table
+    ThermistorTableGen<RTH, BETA, RLOAD, ADCBITS, TABLEBITS, INVERT, TSCALE, TT>::table;
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Lookup over a compile time table; drop in for the generated
+    TempTable* classes.
+ */
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, unsigned TABLEBITS,
+         bool INVERT, unsigned TSCALE>
+class TempTable : public InterpolatedLookup1DBits<int16_t, float, ADCBITS, ADCBITS - TABLEBITS>
+{
+    typedef InterpolatedLookup1DBits<int16_t, float, ADCBITS, ADCBITS - TABLEBITS> Base;
+
+public:
+    typedef ThermistorTableGen<RTH, BETA, RLOAD, ADCBITS, TABLEBITS, INVERT, TSCALE> Gen;
+
+    constexpr TempTable() : Base(Gen::table.v, TSCALE)
+    {}
+
+    static const TempTable _instance;
+};
+
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, unsigned TABLEBITS,
+         bool INVERT, unsigned TSCALE>
+THERMISTOR_TABLE_CONSTINIT const TempTable<RTH, BETA, RLOAD, ADCBITS, TABLEBITS, INVERT, TSCALE>
+    TempTable<RTH, BETA, RLOAD, ADCBITS, TABLEBITS, INVERT, TSCALE>::_instance;
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Direct (one entry per ADC count) lookup over a compile time table.
+    2^ADCBITS int16_t entries; same API as TempTable.
+ */
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, bool INVERT, unsigned TSCALE>
+class DirectTempTable : public DirectLookup1D<int16_t, float, ADCBITS>
+{
+    typedef DirectLookup1D<int16_t, float, ADCBITS> Base;
+
+public:
+    typedef ThermistorTableGen<RTH, BETA, RLOAD, ADCBITS, ADCBITS, INVERT, TSCALE> Gen;
+
+    constexpr DirectTempTable() : Base(Gen::table.v, TSCALE)
+    {}
+
+    static const DirectTempTable _instance;
+};
+
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, bool INVERT, unsigned TSCALE>
+THERMISTOR_TABLE_CONSTINIT const DirectTempTable<RTH, BETA, RLOAD, ADCBITS, INVERT, TSCALE>
+    DirectTempTable<RTH, BETA, RLOAD, ADCBITS, INVERT, TSCALE>::_instance;
+
+//-----------------------------------------------
+//-----------------------------------------------
+/// Default table memory budget for TempTableFor, bytes
+#ifndef THERMISTOR_TABLE_BUDGET
+#if defined(__AVR__)
+#define THERMISTOR_TABLE_BUDGET 256
+#else
+#define THERMISTOR_TABLE_BUDGET 4096
+#endif
+#endif
+
+//-----------------------------------------------
+/// Pick A if C else B; no <type_traits> on the AVR
+template<bool C, typename A, typename B>
+struct SelectType { typedef A type; };
+
+template<typename A, typename B>
+struct SelectType<false, A, B> { typedef B type; };
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    Direct table if it fits BUDGET bytes, else the interpolated
+    TempTable with 2^TABLEBITS entries.
+
+        typedef TempTableFor<100000, 3950, 100000, 10, 5, false, 128>::type Therm;
+        auto t = Therm::_instance.value(adc);
+ */
+template<uint32_t RTH, uint16_t BETA, uint32_t RLOAD, unsigned ADCBITS, unsigned TABLEBITS,
+         bool INVERT, unsigned TSCALE, size_t BUDGET = THERMISTOR_TABLE_BUDGET>
+struct TempTableFor
+{
+    static constexpr bool direct = (size_t(1) << ADCBITS) * sizeof(int16_t) <= BUDGET;
+
+    typedef typename SelectType<
+        direct,
+        DirectTempTable<RTH, BETA, RLOAD, ADCBITS, INVERT, TSCALE>,
+        TempTable<RTH, BETA, RLOAD, ADCBITS, TABLEBITS, INVERT, TSCALE>
+    >::type type;
+};
+
+#endif
@@ -0,0 +1,127 @@
+/** @file
+    Build an interpolated thermistor table at run time from a calibrated
+    Thermistor, so per device calibration gets table speed conversions.
+
+    The table is double buffered. begin() snapshots the calibration and
+    step() fills the back buffer a few entries at a time, one log per
+    entry, so it can be run from the sampling loop; when the last entry
+    is done the buffers swap with a single byte write. lookup() always
+    returns a complete table.
+
+        ThermistorTableBuilder<10, 5> therm(128);
+        therm.build(cal);               // at boot, all at once
+        ...
+        therm.begin(newCal);            // after recalibration
+        loop: therm.step(); t = therm.lookup().raw(adc);
+
+    Entries are computed as thermgen.py computes them, so a calibration
+    that matches a generated table gives the same values.
+ */
+#ifndef THERMISTOR_TABLE_BUILDER_H
+#define THERMISTOR_TABLE_BUILDER_H
+
+#include <stdint.h>
+#include "InterpolatedLookup.h"
+#include "Thermistor.h"
+
+//-----------------------------------------------
+//-----------------------------------------------
+/**
+    @tparam ADCBITS     ADC resolution
+    @tparam TABLEBITS   log2 of table entries
+ */
+template<unsigned ADCBITS, unsigned TABLEBITS>
+class ThermistorTableBuilder
+{
+public:
+    typedef InterpolatedLookup1DBits<int16_t, float, ADCBITS, ADCBITS - TABLEBITS> Lookup;
+
+    static const uint16_t tableSize = uint16_t(1) << TABLEBITS;
+
+private:
+    int16_t _table[2][tableSize];
+    const Lookup _lookup[2];
+    Thermistor _cal;                ///< calibration being built
+    uint16_t _next;                 ///< next entry to build; tableSize when idle
+    volatile uint8_t _front;        ///< table lookup() returns
+    bool _ready;                    ///< a table has been built
+
+    //----------------------------------------------------------
+    /// Entry i, as TabGen.tableTemp(); entry 0 is half a bucket in
+    int16_t entry(uint16_t i) const
+    {
+        const uint16_t bucket = uint16_t(1) << (ADCBITS - TABLEBITS);
+        float c = i == 0 ? 0.5f * bucket
+            : i * bucket >= _cal._adcCountMax ? _cal._adcCountMax - 0.5f
+            : float(i * bucket);
+
+        float t = _cal.tempFromVolts(_cal._vAdcMax * c / _cal._adcCountMax);
+        float v = t * _lookup[0].getScale() + 0.5f;
+        return v >= 32767 ? 32767 : v <= -32767 ? -32767 : int16_t(v);
+    }
+    //----------------------------------------------------------
+
+public:
+    //----------------------------------------------------------
+    ThermistorTableBuilder(float scale = 128)
+        :   _table(),
+            _lookup{ Lookup(_table[0], scale), Lookup(_table[1], scale) },
+            _next(tableSize),
+            _front(0),
+            _ready(false)
+    {}
+    //----------------------------------------------------------
+    /**
+        Start building a table for a calibration; the current table stays
+        in use until the new one is complete.
+        @return false, and nothing started, if the calibration is not valid
+     */
+    bool begin(const Thermistor& cal)
+    {
+        if (!cal.isOk())
+            return false;
+
+        _cal = cal;
+        _next = 0;
+        return true;
+    }
+    //----------------------------------------------------------
+    /**
+        Build up to n more entries.
+        @return true if that completed the table and it is now in use
+     */
+    bool step(uint16_t n = 1)
+    {
+        if (_next >= tableSize)
+            return false;
+
+        int16_t* back = _table[_front ^ 1];
+        for (; n && _next < tableSize; --n, ++_next)
+            back[_next] = entry(_next);
+
+        if (_next < tableSize)
+            return false;
+
+        _front ^= 1;
+        _ready = true;
+        return true;
+    }
+    //----------------------------------------------------------
+    /// Build the whole table now
+    bool build(const Thermistor& cal)
+    {
+        return begin(cal) && step(tableSize);
+    }
+    //----------------------------------------------------------
+    /// A rebuild is in progress
+    bool busy() const { return _next < tableSize; }
+    //----------------------------------------------------------
+    /// A table has been built; lookup() is meaningless before this
+    bool ready() const { return _ready; }
+    //----------------------------------------------------------
+    /// The current complete table
+    const Lookup& lookup() const { return _lookup[_front]; }
+    //----------------------------------------------------------
+};
+
+#endif
@@ -2,6 +2,7 @@
 # Use bisection to create a humidity lookup table
 import math 
 import datetime
+from steinhart import SteinhartHart
 
 ## Thermistor Sresistor
 RTH = 100000
@@ -127,12 +128,26 @@ class Generator:
         self.volts = 3.3
         self.ROsc=402700 # 10kHz nominal
         self.cStrayPf = 0
+        self.slopeLayout = False # also emit a {base, slope} thermistor table
+        self.pow2 = False # power of two humidity grid, so HS1101 shifts instead of dividing
+        self.packed = False # humidity table as per column lines plus int8 residues
+        self.sh = None # SteinhartHart for the thermistor; replaces rth/beta when given
+        self.counts32 = False # count_t is uint32_t, for oscillators or gates past 16 bits of counts
+        self.fcmin = None # humidity columns, counts; None for the 10kHz oscillator's
+        self.fcmax = None
+        self.fcstep = None
+
+        if kwargs.get("pow2"):
+            # 8C rows at x128 is 1024 scaled; 128 count columns
+            self.tstep = 8
+            self.tscale = 128
 
         for k, v in kwargs.items():
             #assert( k in self.__class__.__allowed )
             setattr(self, k, v)
 
         # computed
+        self.tstepsc = self.tstep*self.tscale
         self.tadcmax = (1<<self.tadcbits)-1
 
         rth = fmt(self.rth)
@@ -141,9 +156,16 @@ class Generator:
         stray = ""
         if self.cStrayPf:
             stray = "Cstray{}".format(self.cStrayPf).replace(".","_")
+        grid = "P2" if self.pow2 else ""
+        pack = "Packed" if self.packed else ""
+        model = "SH" if self.sh else ""
+        osc = "" if self.ROsc == 402700 else "Ro" + fmt(self.ROsc)
+        wide = "W32" if self.counts32 else ""
+        self.ctype = "uint32_t" if self.counts32 else "uint16_t"
+        self.countconst = "    typedef uint32_t count_t; ///< Humidity oscillator counts\n" if self.counts32 else ""
 
         if not self.name:
-            self.name = "HS1101Rt{rth}Rs{rsen}Tl{tlo}Th{tmax}{stray}".format(**merge(vars(self),globals(),locals()))
+            self.name = "HS1101Rt{rth}Rs{rsen}Tl{tlo}Th{tmax}{model}{osc}{stray}{grid}{pack}{wide}".format(**merge(vars(self),globals(),locals()))
 
     #---------------------------------------------------------------------------------------------------------------------------    
     ##
@@ -201,6 +223,8 @@ class Generator:
     ##
     # Compute thermistor resistance at temp
     def resAtTemp(self, t):
+        if self.sh:
+            return self.sh.resAtTemp(t)
         x = (1.0/T1-1.0/(t+AZ))
         return self.rth/math.exp(self.beta*x)        
     #---------------------------------------------------------------------------------------------------------------------------    
@@ -208,6 +232,8 @@ class Generator:
     # Compute temp for given resistance
     #
     def tempForRes(self, r):
+        if self.sh:
+            return self.sh.tempForRes(r)
         t2 = 1/(1/T1- math.log(self.rth/r)/self.beta)
         return t2-AZ        
     #---------------------------------------------------------------------------------------------------------------------------    
@@ -243,6 +269,27 @@ class Generator:
         self.thicount = self.thibucket<<self.tresiduebits
         self.trmask = (1<<self.tresiduebits)-1
         self.tscalf = 1.0/self.tscale
+        self.genTempSlopes()
+    #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    ##
+    # Per count slopes for the {base, slope} layout, as HS1101::rawTemp()
+    # interpolates (step >> rbits), with as many fraction bits as fit int16_t
+    def genTempSlopes(self):
+        self.slopeinc = ""
+        self.slopeconst = ""
+        self.slopedecl = ""
+        if not self.slopeLayout:
+            return
+        vals = [i.value for i in self.ttable]
+        steps = [vals[i+1]-vals[i] for i in range(0,len(vals)-1)] + [0]
+        maxslope = max(abs(d) for d in steps)/(1<<self.tresiduebits)
+        self.tslopebits = 0
+        while maxslope*(1<<(self.tslopebits+1)) < (1<<15)-1:
+            self.tslopebits += 1
+        self.tslopes = [int(round(d*(1<<self.tslopebits)/(1<<self.tresiduebits))) for d in steps]
+        self.slopeinc = '#include "InterpolatedSlopeLookup.h"\n'
+        self.slopeconst = "    static const uint16_t _therm_slope_bits    = {0:5d}; ///< Fraction bits in the thermistor slopes\n".format(self.tslopebits)
+        self.slopedecl = "    static const SlopeEntry<int16_t> _therm_slope_table[_therm_table_size];\n"
     #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     def emitTempTable(self):
         self.cf.write("""const int16_t {0}::_tampTable = {{\n""".format(self.name))
@@ -264,7 +311,7 @@ class Generator:
 
 #include <stdint.h>
 #include "HS1101.h"
-
+{slopeinc}
 //=========================================================================================================================
 /** @brief
  * Data class for HS1101
@@ -278,7 +325,7 @@ public:
     static const uint16_t _therm_table_hicount = {thicount:5d}; ///< ADC count for highest bucket
     static const uint16_t _therm_table_rbits   = {tresiduebits:5d}; ///< Bits in the residue
     static const uint16_t _therm_table_rmask   = {trmask:5d}; ///< Mask for the residue
-
+{slopeconst}
 
     static const uint16_t _humid_table_sizeT   = {tcsize:5d}; ///< Entries in dim0 of Humidity table (temp index)
     static const int16_t  _humid_table_tmin    = {tmin:5d}; ///< low temp in table (temp for first row)
@@ -289,12 +336,12 @@ public:
     static const int16_t  _humid_table_stepTsc = {tstepsc:5.0f}; ///< Temperature distance between two rows, scaled (x{tscale})
                       
     static const uint16_t _humid_table_sizeH   = {fcsize:5d}; ///< Entries in dim1 of Humidity table (freq indexed)
-    static const uint16_t _humid_table_locount = {fcmin:5d}; ///< Offset of first bucket (counts in interval)
-    static const uint16_t _humid_table_hicount = {fcmax:5d}; ///< Offset of last bucket (counts in interval)
+    static const {ctype} _humid_table_locount = {fcmin:5d}; ///< Offset of first bucket (counts in interval)
+    static const {ctype} _humid_table_hicount = {fcmax:5d}; ///< Offset of last bucket (counts in interval)
     static const int16_t  _humid_table_stepH   = {fcstep:5.0f}; ///< # counts between column values
     static const uint16_t _humid_table_scale   = {hscale:5d}; ///< Humidity table values are multiplied by this value
     static const int16_t _humid_max_raw        = {hmaxraw:5d}; ///< Humidity table values are multiplied by this value
-    
+{countconst}{gridconst}{packconst}    
     // CStray =  {cStrayPf}Pf
 
     /// Scale a raw temp to °C
@@ -305,8 +352,7 @@ public:
                       
 protected:                      
     static const int16_t  _therm_table[_therm_table_size];
-    static const int16_t  _hs1101_table[_humid_table_sizeT][_humid_table_sizeH];
-
+{slopedecl}{humiddecl}
     
 }};
 
@@ -357,6 +403,57 @@ class {name} : public HS1101<{name}Data>
             self.tminsc = self.tmin*self.tscale
             self.tmaxsc = self.tmax*self.tscale # scale from temp table
     #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    ##
+    # Power of two grid: same first column, 128 count steps, and the last
+    # column at or past fcmax so the same counts are covered
+    def genGrid(self):
+        self.gridconst = ""
+        if not self.pow2:
+            return
+        self.fcstep = 128
+        shiftH = self.fcstep.bit_length()-1
+        shiftTsc = self.tstepsc.bit_length()-1
+        assert self.tstepsc == 1<<shiftTsc, "tstep*tscale must be a power of two"
+        self.gridconst = ("    static const uint16_t _humid_table_shiftH  = {0:5d}; ///< stepH is 1 << this\n"
+                          "    static const uint16_t _humid_table_shiftTsc= {1:5d}; ///< stepTsc is 1 << this\n").format(shiftH, shiftTsc)
+    #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    ##
+    # Packed layout: RH at a fixed count is close to linear in temperature,
+    # so each column is stored as a {base, slope} line over the rows plus
+    # an int8 residue per entry; lossless, HS1101 decodes entries on lookup
+    def genPacked(self):
+        self.packconst = ""
+        self.humiddecl = "    static const int16_t  _hs1101_table[_humid_table_sizeT][_humid_table_sizeH];\n"
+        if not self.packed:
+            return
+
+        self.hlines = []
+        self.hresid = [[] for _ in self.htable]
+        for c in range(self.fcsize):
+            col = [row[c].value for row in self.htable]
+            n = len(col)-1
+            guess = int(round((col[-1]-col[0])/n)) if n else 0
+            best = None
+            # minimax line: for each slope the best base is mid-range
+            for slope in range(guess-256, guess+257):
+                e = [v - r*slope for r, v in enumerate(col)]
+                base = (max(e)+min(e))//2
+                worst = max(max(e)-base, base-min(e))
+                if best is None or worst < best[0]:
+                    best = (worst, base, slope)
+            worst, base, slope = best
+            assert worst <= 127, "column {} does not fit int8 residues".format(c)
+            self.hlines.append((base, slope))
+            for r, v in enumerate(col):
+                res = v - (base + r*slope)
+                assert -128 <= res <= 127
+                self.hresid[r].append(res)
+
+        self.slopeinc = '#include "InterpolatedSlopeLookup.h"\n'
+        self.packconst = "    static const bool     _humid_table_packed  =  true; ///< Humidity table is _hs1101_lines plus _hs1101_resid\n"
+        self.humiddecl = ("    static const SlopeEntry<int16_t> _hs1101_lines[_humid_table_sizeH]; ///< entry [t][h] ~ base + t*slope\n"
+                          "    static const int8_t   _hs1101_resid[_humid_table_sizeT][_humid_table_sizeH]; ///< and the rest\n")
+    #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     def emitTemp(self):
         self.cf.write("""
 const int16_t {name}Data::_therm_table[_therm_table_size] = 
@@ -365,8 +462,20 @@ const int16_t {name}Data::_therm_table[_therm_table_size] =
         for i in self.ttable:
             self.cf.write( "  {0:6d},{1}\n".format(i.value, i.comment) )
         self.cf.write("};\n")
+
+        if self.slopeLayout:
+            self.cf.write("""
+const SlopeEntry<int16_t> {name}Data::_therm_slope_table[_therm_table_size] =
+{{
+""".format(**merge(vars(self),globals())))
+            for i, sl in zip(self.ttable, self.tslopes):
+                self.cf.write( "  {{ {0:6d}, {1:6d} }},{2}\n".format(i.value, sl, i.comment) )
+            self.cf.write("};\n")
     #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     def emitHumid(self):
+        if self.packed:
+            self.emitPacked()
+            return
         self.cf.write("""
 const int16_t {name}Data::_hs1101_table[_humid_table_sizeT][_humid_table_sizeH] = 
 {{
@@ -378,6 +487,26 @@ const int16_t {name}Data::_hs1101_table[_humid_table_sizeT][_humid_table_sizeH]
             self.cf.write("  },")
         self.cf.write("\n};\n")
     #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    def emitPacked(self):
+        self.cf.write("""
+const SlopeEntry<int16_t> {name}Data::_hs1101_lines[_humid_table_sizeH] =
+{{
+""".format(**merge(vars(self),globals())))
+        for c, (base, slope) in enumerate(self.hlines):
+            self.cf.write( "  {{ {0:6d}, {1:6d} }}, // [{2}]\n".format(base, slope, c) )
+        self.cf.write("};\n")
+
+        self.cf.write("""
+const int8_t {name}Data::_hs1101_resid[_humid_table_sizeT][_humid_table_sizeH] =
+{{
+""".format(**merge(vars(self),globals())))
+        for it, rt in zip(self.htable, self.hresid):
+            self.cf.write("  {\n")
+            for i, res in zip(it, rt):
+                self.cf.write( "    {0:4d},{1}\n".format(res, i.comment) )
+            self.cf.write("  },")
+        self.cf.write("\n};\n")
+    #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     def generate(self):
         self.genTempTable()
         print("counts0@-10", self.freqForRhTemp(0,-10))
@@ -397,10 +526,16 @@ const int16_t {name}Data::_hs1101_table[_humid_table_sizeT][_humid_table_sizeH]
 
         #
         # Based on the output of the above
-        self.fcmin =  8500 # counts100@100 3637.3339381412734
-        self.fcmax = 10800 # counts0@-10   4597.754930227302
-        self.fcstep = 100
+        if self.fcmin is None:
+            self.fcmin =  8500 # counts100@100 3637.3339381412734
+            self.fcmax = 10800 # counts0@-10   4597.754930227302
+            self.fcstep = 100
+        assert self.counts32 or self.fcmax+self.fcstep <= 0xffff, "counts past 16 bits need counts32=True"
+        assert not (self.counts32 and self.pow2), "pow2 columns are 128 counts; too fine for wide counts"
+        assert self.fcstep <= 0x7fff, "stepH is an int16_t"
+        self.genGrid()
         self.genHumidTable()
+        self.genPacked()
 
         self.initH()
         self.finishH()
@@ -424,3 +559,13 @@ if __name__ == "__main__":
 
     g = Generator(rsense=150000+2500, tmax=50, cStrayPf=7.2)
     g.generate()
+
+    g = Generator(rsense=150000, tmax=50, cStrayPf=8, pow2=True)
+    g.generate()
+
+    g = Generator(packed=True)
+    g.generate()
+
+    # 10x the oscillator (ROsc/10), ~88k..111k counts in the 1s gate
+    g = Generator(ROsc=40270, counts32=True, fcmin=88000, fcmax=112000, fcstep=1000)
+    g.generate()
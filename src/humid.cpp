@@ -1,17 +1,139 @@
 
 #include "humid.h"
+#include "Reciprocal.h"
+#include "Oversample.h"
+#include "SpscRing.h"
 #include <clocks.h>
 #include <tca.h>
 #include <Arduino.h>
 #include <avr/sleep.h>
 
+#if HUMID_RECIPROCAL && defined(MILLIS_USE_TIMERB0)
+#error "HUMID_RECIPROCAL needs TCB0, which millis() is on; pick another millis timer"
+#endif
+#if HUMID_COUNT32 && defined(MILLIS_USE_TIMERA0)
+#error "HUMID_COUNT32 needs TCA0's overflow vector, which millis() is on; pick another millis timer"
+#endif
+
 bool HumidATtiny3216::_xtalWasEnabled;
+uint8_t HumidATtiny3216::_periods;
+uint32_t HumidATtiny3216::_clkHz = F_CPU;
+#if HUMID_THERMISTOR
+uint8_t HumidATtiny3216::_thermMux = HumidATtiny3216::noThermistor;
+#endif
 
 /// Set whiile we're sampling
 volatile static bool _sampling;
 
 /// Number of counts, updated at end of sampling
-volatile static uint16_t _counts;
+volatile static uint32_t _counts;
+
+/// TCA0 overflows since it was zeroed; the top half of the count
+volatile static uint16_t _countHigh;
+
+/// Set when a sample is in, until it's taken
+volatile static bool _ready;
+
+/// Called when a sample is in
+static HumidATtiny3216::Callback volatile _done;
+
+/// Periods timed by the sample underway (or last), as at beginCounting()
+volatile static uint8_t _gatePeriods;
+
+/// Reciprocal mode: periods still to time
+volatile static uint8_t _periodsLeft;
+
+/// Reciprocal mode: TCB0 was enabled part way through a period
+volatile static bool _partial;
+
+/// Reciprocal mode: main clock ticks over the periods timed, 0 on timeout
+volatile static uint32_t _ticks;
+
+/// Continuous mode: set while windows are queued
+volatile static bool _continuous;
+
+/// Continuous mode: TCA0 count at the last window boundary
+static uint32_t _lastCount;
+
+/// Continuous mode: window counts, ISR to main loop
+static SpscRing<uint32_t, HumidATtiny3216::windowQueue> _windows;
+
+#if HUMID_THERMISTOR
+/// Thermistor: conversions summed through the sample, and how many
+volatile static uint32_t _thermSum;
+volatile static uint16_t _thermSamples;
+
+/// Thermistor: ADC0 set up for it; what to put back
+static bool _thermOn;
+static uint8_t _adcCtrlA, _adcCtrlC, _adcMux;
+#endif
+
+//-----------------------------------------
+/**
+    TCA0 count, extended to 32 bits with HUMID_COUNT32. Interrupts off,
+    i.e. from an ISR or under cli(). An overflow whose ISR hasn't run
+    yet shows as the flag still set; the low half is read again then,
+    so it's certainly past the wrap, and the pending overflow counted
+    here.
+ */
+static uint32_t count32()
+{
+#if HUMID_COUNT32
+    uint16_t hi = _countHigh;
+    uint16_t lo = TCA0Control::count();
+    if(TCA0.SINGLE.INTFLAGS & TCA_SINGLE_OVF_bm)
+    {
+        lo = TCA0Control::count();
+        ++hi;
+    }
+    return (uint32_t(hi) << 16) | lo;
+#else
+    return TCA0Control::count();
+#endif
+}
+//-----------------------------------------
+/// TCA0 from 0, the overflows with it
+static void zeroCount()
+{
+    TCA0Control::count(0);
+    _countHigh = 0;
+    TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
+}
+//-----------------------------------------
+static uint16_t saturate(uint32_t c)
+{
+    return c > 0xffff ? 0xffff : uint16_t(c);
+}
+
+#if HUMID_THERMISTOR
+//-----------------------------------------
+/// Stop the thermistor conversions and give ADC0 back
+static void endThermistor()
+{
+    if(!_thermOn)
+        return;
+    _thermOn = false;
+    ADC0.EVCTRL = 0;
+    ADC0.INTCTRL = 0;
+    ADC0.CTRLA = 0;
+    ADC0.INTFLAGS = ADC_RESRDY_bm;
+    ADC0.CTRLC = _adcCtrlC;
+    ADC0.MUXPOS = _adcMux;
+    ADC0.CTRLA = _adcCtrlA;
+}
+#endif
+//-----------------------------------------
+/// Sample in; from the ISR that ended it
+static void complete()
+{
+#if HUMID_THERMISTOR
+    endThermistor();
+#endif
+    _sampling = false;
+    _ready = true;
+    if(_done)
+        _done();
+}
 
 //-----------------------------------------
 void HumidATtiny3216::initEvSys()
@@ -21,6 +143,11 @@ void HumidATtiny3216::initEvSys()
 
     //SYNCUSER0 SYNCCH0;
     EVSYS.SYNCUSER0 = 0x1;
+
+#if HUMID_RECIPROCAL
+    //ASYNCUSER0 (TCB0) SYNCCH0; the same edges, for reciprocal mode
+    EVSYS.ASYNCUSER0 = 0x1;
+#endif
 }
 
 //-----------------------------------------
@@ -31,6 +158,9 @@ void HumidATtiny3216::initTCA0()
     TCA0Control::clockSelect(TcaClock::Div1028);
     TCA0Control::eventAction(EventAction::PosEdge);
     TCA0Control::eventCountEnable(true);
+#if HUMID_COUNT32
+    TCA0.SINGLE.INTCTRL = TCA_SINGLE_OVF_bm;    // count32()
+#endif
 }
 
 //-----------------------------------------
@@ -41,36 +171,267 @@ void HumidATtiny3216::initRTC()
     RtcControl::runInSleep(true);
 
 }
+#if HUMID_RECIPROCAL
+//-----------------------------------------
+/**
+    Frequency measurement: each event edge captures the ticks since the
+    last into CCMP and restarts CNT, so ISR latency doesn't matter as
+    long as CCMP is read within a period. A period must be under 65536
+    clocks, i.e. an oscillator above ~305Hz at 20MHz.
+ */
+void HumidATtiny3216::initTCB0()
+{
+    TCB0.CTRLA = 0;                     // off until beginCounting()
+    TCB0.CTRLB = TCB_CNTMODE_FRQ_gc;
+    TCB0.EVCTRL = TCB_CAPTEI_bm;        // positive edge
+    TCB0.INTCTRL = TCB_CAPT_bm;
+}
+#endif
 //-----------------------------------------
 void HumidATtiny3216::init()
 {
     initEvSys();
     initTCA0();
+#if HUMID_RECIPROCAL
+    initTCB0();
+#endif
     initRTC();
     ClockControl::waitForXtal();
     RtcControl::clockXT32k();
 }
+#if HUMID_RECIPROCAL
 //-----------------------------------------
-void HumidATtiny3216::beginCounting()
+void HumidATtiny3216::setReciprocal(uint8_t periods)
 {
-    //Serial.write("4\n");
-    TCA0Control::count(0);
+    _periods = periods > ReciprocalCount::maxPeriods ? ReciprocalCount::maxPeriods : periods;
+}
+#endif
+#if HUMID_THERMISTOR
+//-----------------------------------------
+void HumidATtiny3216::setThermistor(uint8_t muxpos)
+{
+    uint8_t was = _thermMux;
+    _thermMux = muxpos;
+    if(muxpos == noThermistor)
+    {
+        if(was == noThermistor)
+            return;     // the PIT may be the application's
 
+        // a sample under way finishes without its conversions
+        cli();
+        endThermistor();
+        _thermSamples = 0;
+        sei();
+
+        EVSYS.ASYNCUSER1 = 0;
+        EVSYS.ASYNCCH3 = 0;
+        while(RTC.PITSTATUS & RTC_CTRLBUSY_bm)
+            ;
+        RTC.PITCTRLA = 0;
+        return;
+    }
+
+    //ASYNCCH3 PIT_DIV64, 512Hz off the 32kHz RTC clock
+    EVSYS.ASYNCCH3 = 0x11;
+
+    //ASYNCUSER1 (ADC0) ASYNCCH3
+    EVSYS.ASYNCUSER1 = 0x6;
+
+    // the PIT has to run for its events; its interrupt stays off
+    while(RTC.PITSTATUS & RTC_CTRLBUSY_bm)
+        ;
+    RTC.PITINTCTRL = 0;
+    RTC.PITCTRLA = RTC_PERIOD_CYC32768_gc | RTC_PITEN_bm;
+}
+//-----------------------------------------
+/**
+    Each PIT event starts a conversion (~12us at 20MHz, ADC clock
+    CLK_PER/16); ISR(ADC0_RESRDY_vect) sums them until complete().
+ */
+void HumidATtiny3216::beginThermistor()
+{
+    _thermSum = 0;
+    _thermSamples = 0;
+    if(_thermMux == noThermistor)
+        return;
+
+    _adcCtrlA = ADC0.CTRLA;
+    _adcCtrlC = ADC0.CTRLC;
+    _adcMux = ADC0.MUXPOS;
+    _thermOn = true;
+
+    ADC0.CTRLA = 0;
+    ADC0.CTRLC = ADC_SAMPCAP_bm | ADC_REFSEL_VDDREF_gc | ADC_PRESC_DIV16_gc;
+    ADC0.MUXPOS = _thermMux;
+    ADC0.INTFLAGS = ADC_RESRDY_bm;
+    ADC0.INTCTRL = ADC_RESRDY_bm;
+    ADC0.EVCTRL = ADC_STARTEI_bm;
+    ADC0.CTRLA = ADC_RESSEL_10BIT_gc | ADC_ENABLE_bm;
+}
+#endif
+//-----------------------------------------
+void HumidATtiny3216::calibrateClock()
+{
+    // one gate with TCA0 counting CLK_PER/1024 instead of events
+    uint8_t periods = _periods;
+    _periods = 0;
+#if HUMID_THERMISTOR
+    // the PIT events keep running, but nothing converts on them
+    uint8_t thermMux = _thermMux;
+    _thermMux = noThermistor;
+#endif
+    TCA0Control::eventCountEnable(false);
+    beginCounting();
+    uint32_t n = endCounting32();
+    TCA0Control::eventCountEnable(true);
+    _periods = periods;
+#if HUMID_THERMISTOR
+    _thermMux = thermMux;
+#endif
+
+    if(n)
+        _clkHz = n << 10;
+}
+//-----------------------------------------
+void HumidATtiny3216::beginGate()
+{
     RtcControl::enable(false);
     RtcControl::clearInterruptFlags();
     RtcControl::clearPrescaler();
     RtcControl::period(7); //  1s
     RtcControl::enable(true);
+}
+//-----------------------------------------
+void HumidATtiny3216::beginCounting(Callback done)
+{
+    //Serial.write("4\n");
+    _done = done;
+    _ready = false;
+#if HUMID_THERMISTOR
+    beginThermistor();
+#endif
+    _gatePeriods = _periods;
+
+#if HUMID_RECIPROCAL
+    if(_gatePeriods)
+    {
+        _ticks = 0;
+        _periodsLeft = _gatePeriods;
+        _partial = true;
+        _sampling = true;
+        beginGate();    // only a timeout here, if the oscillator has stopped
+        TCB0.INTFLAGS = TCB_CAPT_bm;
+        TCB0.CTRLA = TCB_CLKSEL_CLKDIV1_gc | TCB_ENABLE_bm;
+        return;
+    }
+#endif
+
+    zeroCount();
+    beginGate();
     TCA0Control::enable(true);
     _sampling = true;
 }
 //-----------------------------------------
+void HumidATtiny3216::beginContinuous(Callback done)
+{
+    _done = done;
+    _windows.reset();
+    _lastCount = 0;
+    _continuous = true;
+
+    zeroCount();
+    beginGate();
+    TCA0Control::enable(true);
+}
+//-----------------------------------------
+void HumidATtiny3216::endContinuous()
+{
+    _continuous = false;    // first, so a late overflow does nothing
+    RtcControl::enable(false);
+    TCA0Control::enable(false);
+}
+//-----------------------------------------
+bool HumidATtiny3216::takeWindow(uint32_t& counts)
+{
+    return _windows.pop(counts);
+}
+//-----------------------------------------
+bool HumidATtiny3216::takeWindow(uint16_t& counts)
+{
+    uint32_t c;
+    if(!takeWindow(c))
+        return false;
+    counts = saturate(c);
+    return true;
+}
+//-----------------------------------------
+uint8_t HumidATtiny3216::windowsDropped()
+{
+    return _windows.dropped();
+}
+//-----------------------------------------
 bool HumidATtiny3216::isCounting()
 {
     return _sampling;
 }
 //----------------------------------------_
 uint16_t HumidATtiny3216::endCounting()
+{
+    return saturate(endCounting32());
+}
+//-----------------------------------------
+uint32_t HumidATtiny3216::endCounting32()
+{
+    waitForSample();
+    _ready = false;
+    return result();
+}
+//-----------------------------------------
+bool HumidATtiny3216::takeCounts(uint16_t& counts)
+{
+    uint32_t c;
+    if(!takeCounts(c))
+        return false;
+    counts = saturate(c);
+    return true;
+}
+//-----------------------------------------
+bool HumidATtiny3216::takeCounts(uint32_t& counts)
+{
+    if(!_ready)
+        return false;
+    _ready = false;
+
+    if(_xtalWasEnabled)
+        ClockControl::disableXtal();
+
+    counts = result();
+    return true;
+}
+#if HUMID_THERMISTOR
+//-----------------------------------------
+bool HumidATtiny3216::takeThermistor(uint16_t& adc, uint8_t extraBits)
+{
+    if(_sampling || _thermSamples == 0)
+        return false;
+    adc = Oversample::mean(_thermSum, _thermSamples, extraBits);
+    return true;
+}
+//-----------------------------------------
+uint16_t HumidATtiny3216::thermistorSamples()
+{
+    return _thermSamples;
+}
+#endif
+//-----------------------------------------
+uint32_t HumidATtiny3216::result()
+{
+    if(_gatePeriods)
+        return ReciprocalCount::counts32(_gatePeriods, _ticks, _clkHz);
+    return _counts;
+}
+//-----------------------------------------
+void HumidATtiny3216::waitForSample()
 {
     set_sleep_mode(SLEEP_MODE_IDLE);
     cli();
@@ -78,7 +439,7 @@ uint16_t HumidATtiny3216::endCounting()
     if(!_sampling)
     {
         sei();
-        return _counts;
+        return;
     }
 
     sleep_enable();
@@ -94,7 +455,6 @@ uint16_t HumidATtiny3216::endCounting()
         ClockControl::disableXtal();
 
     //Serial.printf("counts=%u\r\n", _counts);
-    return _counts;
 }
 //-----------------------------------------
 void HumidATtiny3216::wake()
@@ -115,12 +475,30 @@ ISR(RTC_CNT_vect)
 
     if ( (RTC.INTCTRL & RTC_OVF_bm) && (RTC.INTFLAGS & RTC_OVF_bm) )
     {
-        if(_sampling)
+        if(_continuous)
+        {
+            // TCA0 and the RTC keep running; the window is the difference
+            uint32_t c = count32();
+            _windows.push(HUMID_COUNT32 ? c - _lastCount : uint16_t(c - _lastCount));
+            _lastCount = c;
+            if(_done)
+                _done();
+        }
+        else if(_sampling)
         {
-            _counts = TCA0Control::count();
-            _sampling = false;
+            _counts = count32();
             RtcControl::enable(false);
             TCA0Control::enable(false);
+
+#if HUMID_RECIPROCAL
+            if(TCB0.CTRLA & TCB_ENABLE_bm)
+            {
+                // reciprocal mode timed out; the oscillator has stopped
+                TCB0.CTRLA = 0;
+                _ticks = 0;
+            }
+#endif
+            complete();
         }
     }
 
@@ -131,6 +509,43 @@ ISR(RTC_CNT_vect)
 
     RTC.INTFLAGS = (RTC_OVF_bm | RTC_CMP_bm);
 }
+#if HUMID_COUNT32
+//----------------------------------------------------------------------------------
+ISR(TCA0_OVF_vect)
+{
+    ++_countHigh;
+    TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
+}
+#endif
+#if HUMID_THERMISTOR
+//----------------------------------------------------------------------------------
+ISR(ADC0_RESRDY_vect)
+{
+    _thermSum += ADC0.RES;      // clears RESRDY
+    ++_thermSamples;
+}
+#endif
+#if HUMID_RECIPROCAL
+//----------------------------------------------------------------------------------
+ISR(TCB0_INT_vect)
+{
+    uint16_t period = TCB0.CCMP;    // clears CAPT
+
+    if(_partial)
+    {
+        _partial = false;
+        return;
+    }
+
+    _ticks += period;
+    if(--_periodsLeft == 0)
+    {
+        TCB0.CTRLA = 0;
+        RtcControl::enable(false);
+        complete();
+    }
+}
+#endif
 //----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -6,6 +6,21 @@
 #include <avr/interrupt.h>
 #include <avr/cpufunc.h>
 
+/*
+    Opt-in parts, each taking a peripheral and its interrupt vector that
+    the core or a sketch may want too; enable in build_flags, e.g.
+    -D HUMID_RECIPROCAL=1.
+ */
+#ifndef HUMID_RECIPROCAL
+#define HUMID_RECIPROCAL 0      ///< setReciprocal(): TCB0, TCB0_INT_vect
+#endif
+#ifndef HUMID_COUNT32
+#define HUMID_COUNT32 0         ///< 32 bit counts: TCA0_OVF_vect
+#endif
+#ifndef HUMID_THERMISTOR
+#define HUMID_THERMISTOR 0      ///< setThermistor(): ADC0, ADC0_RESRDY_vect, PIT events
+#endif
+
 //=============================================
 /**
  * Facet class for IotStation.
@@ -14,10 +29,46 @@
  
    - Uses events, TCA0 and RTC/PIT
    - RTC is set to use 32kHz Xtal, with 8k prescaler -> 250ms ticks
+   - Reciprocal mode (HUMID_RECIPROCAL) also uses TCB0: N oscillator
+     periods are timed against the main clock in tens of ms instead of
+     a 1s gate, see Reciprocal.h. The RTC window still runs, as a
+     timeout. megaTinyCore's tone() and Servo default to TCB0, and
+     millis() can be put on it; those and reciprocal mode exclude each
+     other.
+   - endCounting() sleeps until the sample is in; to overlap the window
+     with other work, pass beginCounting() a callback and collect the
+     sample with takeCounts():
+
+        static volatile bool humidDone;
+        HumidATtiny3216::beginCounting([]{ humidDone = true; });
+        ... thermistor ADC, radio ...
+        uint16_t counts;
+        if(humidDone && HumidATtiny3216::takeCounts(counts)) ...
+
+   - beginContinuous() runs back to back 1s windows with no dead time
+     between them, queued for takeWindow() to average or decimate.
+   - With HUMID_COUNT32, TCA0's overflow interrupt extends its count to
+     32 bits, for faster oscillators or longer gates; the ...32 /
+     uint32_t calls return it whole, the 16 bit ones saturate rather
+     than wrap. Tables generated with counts32=True take the 32 bit
+     counts. Without it, counts wrap at 16 bits as TCA0 does. TCA0 is
+     humid's anyway, but megaTinyCore can put millis() on it, with its
+     own overflow vector.
+   - With HUMID_THERMISTOR, setThermistor() has beginCounting() convert
+     the thermistor on ADC0 through the sample too, started by RTC PIT
+     events on ASYNCCH3 at 512Hz and summed in the ADC ISR;
+     takeThermistor() then gives the oversampled reading, so one wake
+     has both. The ADC ISR is humid's then; analogRead() still works
+     between samples, ADC0 is put back after each.
  */
 class HumidATtiny3216
 {
     static bool _xtalWasEnabled;
+    static uint8_t _periods;        ///< 0 for the 1s gate
+    static uint32_t _clkHz;         ///< main clock, as last calibrated
+#if HUMID_THERMISTOR
+    static uint8_t _thermMux;       ///< thermistor ADC0 input, or noThermistor
+#endif
     
     //-----------------------------------------
     static void initEvSys();
@@ -26,17 +77,78 @@ class HumidATtiny3216
     //-----------------------------------------
     static void initRTC();
     //-----------------------------------------
+#if HUMID_RECIPROCAL
+    static void initTCB0();
+#endif
+    //-----------------------------------------
+    static void beginGate();
+    //-----------------------------------------
+#if HUMID_THERMISTOR
+    static void beginThermistor();
+#endif
+    //-----------------------------------------
+    static void waitForSample();
+    //-----------------------------------------
+    static uint32_t result();
+    //-----------------------------------------
 public:
+    /// Sample complete, called from the ISR that ended it
+    typedef void (*Callback)();
+
+    /// Continuous windows queued for takeWindow()
+    static const uint8_t windowQueue = 8;
+#if HUMID_THERMISTOR
+
+    /// setThermistor(): no concurrent thermistor conversions
+    static const uint8_t noThermistor = 0xff;
+#endif
+    //-----------------------------------------
     static void selectAccurateClock();
     static void selectInaccurateClock();
     //-----------------------------------------
     static void init();
+#if HUMID_RECIPROCAL
+    //-----------------------------------------
+    /**
+        Select reciprocal counting of this many oscillator periods, at
+        most ReciprocalCount::maxPeriods; 0 goes back to the 1s gate.
+        endCounting() gives the same 1s equivalent counts either way.
+     */
+    static void setReciprocal(uint8_t periods);
+#endif
     //-----------------------------------------
     /**
-        Begin event counting.
+        Measure the main clock against the 32kHz crystal, blocking for
+        1s. Reciprocal counts are only as accurate as the main clock, and
+        the internal oscillator drifts with temperature, so redo this
+        when the temperature has moved. No thermistor conversions run
+        through it.
+     */
+    static void calibrateClock();
+#if HUMID_THERMISTOR
+    //-----------------------------------------
+    /**
+        Convert the thermistor through each beginCounting() sample, for
+        takeThermistor(). ADC0 is set up for it (10 bit, VDD reference,
+        so ratiometric with a divider off VDD) and put back as it was
+        when the sample is in. The 1s gate gives ~512 conversions, a
+        reciprocal sample only a few.
+        @param muxpos   ADC_MUXPOS_AINn_gc of the thermistor divider, or
+                        noThermistor to stop: ADC0 is put back if a
+                        sample is converting, and the PIT, ASYNCCH3
+                        and ASYNCUSER1 are turned off again
+        @note Uses EVSYS ASYNCCH3 / ASYNCUSER1 and the PIT events
+     */
+    static void setThermistor(uint8_t muxpos);
+#endif
+    //-----------------------------------------
+    /**
+        Begin event counting, or period timing in reciprocal mode.
+        @param done Called in interrupt context when the sample is in,
+                    so keep it to setting a flag or posting an event
         @note Uses PIT
     */
-    static void beginCounting();
+    static void beginCounting(Callback done = nullptr);
     //-----------------------------------------
     /**
      * @return true if sampling is (still) underway                                                                     
@@ -47,10 +159,60 @@ public:
      * End event count.
        - PIT is left disabled
        
-       @return number of events
+       @return number of events, or the 1s equivalent in reciprocal
+               mode (0 if the oscillator didn't run); 0xffff if more
      */
     static uint16_t endCounting();
     //-----------------------------------------
+    /// endCounting(), all 32 bits
+    static uint32_t endCounting32();
+    //-----------------------------------------
+    /**
+     * endCounting() without the wait.
+       @param[out] counts   As endCounting() would return
+       @return true, once per sample, when the sample is in
+     */
+    static bool takeCounts(uint16_t& counts);
+    static bool takeCounts(uint32_t& counts);
+#if HUMID_THERMISTOR
+    //-----------------------------------------
+    /**
+       Thermistor conversions through the last sample, oversampled; once
+       it's in (endCounting() or takeCounts()).
+       @param[out] adc      Mean conversion, with extraBits of fraction,
+                            see Oversample.h
+       @return false if there were none, or the sample isn't in yet
+     */
+    static bool takeThermistor(uint16_t& adc, uint8_t extraBits = 0);
+    //-----------------------------------------
+    /// Thermistor conversions summed in the last sample
+    static uint16_t thermistorSamples();
+#endif
+    //-----------------------------------------
+    /**
+        Continuous counting: TCA0 runs free and the RTC overflows every
+        1s; the ISR queues the count since the previous overflow, so
+        every edge lands in exactly one window and ISR latency only
+        shifts a boundary. Gate counting only, whatever setReciprocal()
+        says; don't beginCounting() until endContinuous().
+        @param done Called in interrupt context per window
+     */
+    static void beginContinuous(Callback done = nullptr);
+    //-----------------------------------------
+    /// Stop continuous counting; queued windows stay for takeWindow()
+    static void endContinuous();
+    //-----------------------------------------
+    /**
+       Oldest queued window.
+       @param[out] counts   Events in the window
+       @return false if none is waiting
+     */
+    static bool takeWindow(uint16_t& counts);
+    static bool takeWindow(uint32_t& counts);
+    //-----------------------------------------
+    /// Windows lost to a full queue since beginContinuous()
+    static uint8_t windowsDropped();
+    //-----------------------------------------
     static void wake();
     static void sleep();
     //-----------------------------------------
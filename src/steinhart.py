@@ -0,0 +1,83 @@
+##
+# Steinhart-Hart thermistor model, 1/T = a + b ln(R) + c ln(R)^3,
+# for thermgen.py and hs1101.py; the same maths as SteinhartHart.h
+#
+#   sh = SteinhartHart.fit([(-20, 1055000), (25, 100000), (85, 10440)])
+#   TabGen(100000, 3950, 100000, 10, 5, sh=sh).generate()
+#
+import math
+
+AZ=273.15
+
+#===================================================================
+class SteinhartHart:
+    def __init__(self, a, b, c):
+        self.a = a
+        self.b = b
+        self.c = c
+
+    def __repr__(self):
+        return "SteinhartHart({0!r}, {1!r}, {2!r})".format(self.a, self.b, self.c)
+
+    #-----------------------------------------------------------
+    ##
+    # The Beta equation through rth at t0 C; c is 0
+    @staticmethod
+    def fromBeta(rth, beta, t0=25):
+        return SteinhartHart(1/(t0+AZ) - math.log(rth)/beta, 1/beta, 0.0)
+
+    #-----------------------------------------------------------
+    ##
+    # Least squares fit to three or more (temperature C, resistance)
+    # points; exact through three. Solved on ln(R) scaled by its mean,
+    # which keeps the normal equations well conditioned.
+    @staticmethod
+    def fit(points):
+        assert len(points) >= 3, "need three points"
+        m = sum(math.log(r) for t, r in points)/len(points)
+
+        A = [[0.0]*4 for i in range(3)]
+        for t, r in points:
+            s = math.log(r)/m
+            v = [1.0, s, s*s*s]
+            y = 1/(t+AZ)
+            for i in range(3):
+                for k in range(3):
+                    A[i][k] += v[i]*v[k]
+                A[i][3] += v[i]*y
+
+        for col in range(3):
+            piv = max(range(col, 3), key=lambda i: abs(A[i][col]))
+            assert abs(A[piv][col]) > 1e-12*abs(A[0][0]), "points don't determine the model"
+            A[col], A[piv] = A[piv], A[col]
+            for i in range(3):
+                if i != col:
+                    f = A[i][col]/A[col][col]
+                    A[i] = [x - f*y for x, y in zip(A[i], A[col])]
+
+        return SteinhartHart(A[0][3]/A[0][0], A[1][3]/A[1][1]/m, A[2][3]/A[2][2]/(m*m*m))
+
+    #-----------------------------------------------------------
+    def tempForRes(self, r):
+        l = math.log(r)
+        return 1/(self.a + (self.b + self.c*l*l)*l) - AZ
+
+    #-----------------------------------------------------------
+    ##
+    # The depressed cubic in ln(R), solved in closed form
+    def resAtTemp(self, t):
+        y = self.a - 1/(t+AZ)
+        if self.c == 0:
+            return math.exp(-y/self.b)
+        y /= self.c
+        p = self.b/(3*self.c)
+        x = math.sqrt(p*p*p + y*y/4)
+        cbrt = lambda v: math.copysign(abs(v)**(1.0/3), v)
+        return math.exp(cbrt(x - y/2) - cbrt(x + y/2))
+
+    #-----------------------------------------------------------
+    ##
+    # For file comments
+    def describe(self):
+        return "A={0:.10e} B={1:.10e} C={2:.10e}".format(self.a, self.b, self.c)
+#===================================================================
@@ -21,6 +21,7 @@
 #---------------------------------------------------------------------------------------------------------------------------    
 import math
 import datetime
+from steinhart import SteinhartHart
 
 # Some constants
 AZ=273.15
@@ -35,6 +36,12 @@ def fmt(v):
   else:
       return "{:.2f}R".format(v)
 
+def merge(*dict_args):
+  result = {}
+  for dictionary in dict_args:
+    result.update(dictionary)
+  return result
+
 def fmtshort(v):
   av = math.fabs(v)
   if av>=1e6:
@@ -47,9 +54,12 @@ def fmtshort(v):
 #===================================================================
 class TabGen:
     #---------------------------------------------------------------------------------------------------------------------------    
-    def __init__(self,Rth,B, Rl, adcbits, tblbits, invert=False, vnom=3.3, type="int16_t", tscale=100, rtype="float"):
+    def __init__(self,Rth,B, Rl, adcbits, tblbits, invert=False, vnom=3.3, type="int16_t", tscale=100, rtype="float", layout="plain",
+                 tolerance=0.1, tmin=-40, tmax=125, ibits=5, sh=None):
         self.Rth = Rth
         self.B = B
+        self.sh = sh # SteinhartHart; replaces Rth/B when given
+        self.model = "SH           = " + sh.describe() if sh else "B            = {0}".format(B)
         self.Rl = Rl
         self.adcbits = adcbits
         self.tblbits = tblbits
@@ -64,19 +74,28 @@ class TabGen:
         self.rthstr = fmt(Rth)
         self.rlstr = fmt(Rl)
         self.rtype = "float"
+        self.layout = layout
+        self.tolerance = tolerance
+        self.tmin = tmin
+        self.tmax = tmax
+        self.ibits = ibits
         
     #---------------------------------------------------------------------------------------------------------------------------    
     #
     # Compute resistance at temp
     def resAtTemp(self,t):
+        if self.sh:
+            return self.sh.resAtTemp(t)
         x = (1.0/T1-1.0/(t+AZ))
-        return self.Rl/math.exp(self.B*x)        
+        return self.Rth/math.exp(self.B*x)        
     #---------------------------------------------------------------------------------------------------------------------------    
     #
     # Compute temp for given resistance
     #
     def tempForRes(self, r):
-        t2 = 1/(1/T1- math.log(self.Rl/r)/self.B)
+        if self.sh:
+            return self.sh.tempForRes(r)
+        t2 = 1/(1/T1- math.log(self.Rth/r)/self.B)
         return t2-AZ        
     #---------------------------------------------------------------------------------------------------------------------------    
     #
@@ -85,12 +104,12 @@ class TabGen:
     def countsAtTemp(self, t):
         vfrac = self.Rl/(self.Rl+self.resAtTemp(t))
         
-        cfrac = ADCMAX*vf
+        cfrac = self.ADCMAX*vfrac
         
         if self.invert:
-            cfrac = ADCMAX - cfrac
+            cfrac = self.ADCMAX - cfrac
             
-        return int(ac+0.5)
+        return int(cfrac+0.5)
     #---------------------------------------------------------------------------------------------------------------------------    
     #
     # Temperatue given the actual ADC count
@@ -107,6 +126,15 @@ class TabGen:
         return self.tempForRes(rth)
     
     #---------------------------------------------------------------------------------------------------------------------------    
+    #
+    # Temperature for table entry i; entry 0 is a fake half bucket
+    #
+    def tableTemp(self, i):
+        cscale = 1<<self.rbits
+        if i==0:
+            return self.tempForCounts(0.5*cscale)
+        return self.tempForCounts(i*cscale)
+    #---------------------------------------------------------------------------------------------------------------------------    
     def genTable(self, fn):
         print("table:",fn)
         of = open(fn+".cpp","w")
@@ -116,7 +144,7 @@ class TabGen:
    AUTOGENERATED Thermistor table
    
    Rth          = {rthstr}
-   B            = {B}
+   {model}
    Rload        = {rlstr}
    Inverted     = {invert}
    ADC bits     = {adcbits}
@@ -133,16 +161,14 @@ class TabGen:
 const {1} {0}::_table[] = {{
 """.format(fn, self.type))
 
-        cscale = 1<<self.tblbits
+        cscale = 1<<self.rbits
         
         for i in range(0,self.tsize):
           c = i*cscale
           comment =""
+          t = self.tableTemp(i)
           if i==0:
-              t = self.tempForCounts(0.5*cscale) # fake
               comment =" INACCURATE"
-          else:
-              t = self.tempForCounts(c)
               
           if i == self.tsize-1:
               comment =" INACCURATE"
@@ -185,7 +211,7 @@ const {1} {0}::_table[] = {{
    AUTOGENERATED Thermistor table
    
    Rth          = {rthstr}
-   B            = {B}
+   {model}
    Rload        = {rlstr}
    Inverted     = {invert}
    ADC bits     = {adcbits}
@@ -214,12 +240,342 @@ public:
         
         of.close()
     #---------------------------------------------------------------------------------------------------------------------------    
+    #
+    # Interleaved {base, slope} table for InterpolatedSlopeLookup1D.
+    # Slopes are per count (step/maxResidue, as raw() interpolates) with
+    # as many fraction bits as still fit the table type.
+    #
+    def genSlopeTable(self, fn):
+        print("slope table:",fn)
+        maxres = (1<<self.rbits)-1
+        base = [int(self.tableTemp(i)*self.tscale+0.5) for i in range(0,self.tsize)]
+        steps = [base[i+1]-base[i] for i in range(0,self.tsize-1)] + [0]
+        tmax = (1<<15)-1 if self.type=="int16_t" else (1<<7)-1
+        maxslope = max(abs(d) for d in steps)/maxres
+        self.slopebits = 0
+        while maxslope*(1<<(self.slopebits+1)) < tmax:
+            self.slopebits += 1
+
+        of = open(fn+".cpp","w")
+        of.write("""
+/**
+ @file
+   AUTOGENERATED Thermistor table, {{base, slope}} layout
+
+   Rth          = {rthstr}
+   {model}
+   Rload        = {rlstr}
+   Inverted     = {invert}
+   ADC bits     = {adcbits}
+   Table bits   = {tblbits}
+   Slope bits   = {slopebits}
+   Temp Scaled  = x{tscale}
+ */
+""".format(**vars(self)))
+
+        of.write("""
+
+#include "{0}.h"
+
+
+const SlopeEntry<{1}> {0}::_table[] = {{
+""".format(fn, self.type))
+
+        for i in range(0,self.tsize):
+          slope = int(round(steps[i]*(1<<self.slopebits)/maxres))
+          of.write("  {{ {0:8d}, {1:6d} }}, // #{2} c={3}\n".format(base[i], slope, i, i<<self.rbits))
+
+        of.write("""
+\n}};
+
+// static instance
+{fn} {fn}::_instance;
+
+""".format(**vars()));
+
+        of.close()
+    #---------------------------------------------------------------------------------------------------------------------------
+    def genSlopeHeader(self,fn):
+        print("header:",fn)
+        of = open(fn+".h","w")
+        of.write("""
+/**
+ @file
+   AUTOGENERATED Thermistor table, {{base, slope}} layout
+
+   Rth          = {rthstr}
+   {model}
+   Rload        = {rlstr}
+   Inverted     = {invert}
+   ADC bits     = {adcbits}
+   Table bits   = {tblbits}
+   Slope bits   = {slopebits}
+   Temp Scaled  = x{tscale}
+ */
+#include "InterpolatedSlopeLookup.h"
+
+class {fn} : public InterpolatedSlopeLookup1DBits<{type}, {rtype}, {adcbits}, {rbits}, {slopebits}>
+{{
+    typedef InterpolatedSlopeLookup1DBits<{type},{rtype}, {adcbits}, {rbits}, {slopebits}> Base;
+
+    static const SlopeEntry<{type}> _table[];
+
+public:
+    {fn}() : Base(_table, {tscale})
+    {{}}
+
+    static {fn} _instance;
+
+}};
+
+
+
+""".format(**vars(self)))
+
+        of.close()
+    #---------------------------------------------------------------------------------------------------------------------------
+    #
+    # One entry per ADC count for DirectLookup1D. The ends are taken half
+    # a count in (the end counts are infinite) and values saturate.
+    #
+    def genDirectTable(self, fn):
+        print("direct table:",fn)
+        tmax = (1<<15)-1 if self.type=="int16_t" else (1<<7)-1
+        of = open(fn+".cpp","w")
+        of.write("""
+/**
+ @file
+   AUTOGENERATED Thermistor table, one entry per count
+
+   Rth          = {rthstr}
+   {model}
+   Rload        = {rlstr}
+   Inverted     = {invert}
+   ADC bits     = {adcbits}
+   Temp Scaled  = x{tscale}
+ */
+
+
+#include "{fn}.h"
+
+
+const {type} {fn}::_table[] = {{
+""".format(**merge(vars(self), {"fn":fn})))
+
+        for c in range(0, self.ADCMAX+1):
+          t = self.tempForCounts(min(max(c, 0.5), self.ADCMAX-0.5))
+          ts = min(max(int(t*self.tscale+0.5), -tmax), tmax)
+          of.write("  {0:8d}, // c={1} t={2:.2f}C\n".format(ts, c, t))
+
+        of.write("""
+\n}};
+
+// static instance
+{fn} {fn}::_instance;
+
+""".format(**vars()));
+
+        of.close()
+    #---------------------------------------------------------------------------------------------------------------------------
+    def genDirectHeader(self,fn):
+        print("header:",fn)
+        of = open(fn+".h","w")
+        of.write("""
+/**
+ @file
+   AUTOGENERATED Thermistor table, one entry per count
+
+   Rth          = {rthstr}
+   {model}
+   Rload        = {rlstr}
+   Inverted     = {invert}
+   ADC bits     = {adcbits}
+   Temp Scaled  = x{tscale}
+ */
+#include "DirectLookup.h"
+
+class {fn} : public DirectLookup1D<{type}, {rtype}, {adcbits}>
+{{
+    typedef DirectLookup1D<{type}, {rtype}, {adcbits}> Base;
+
+    static const {type} _table[];
+
+public:
+    {fn}() : Base(_table, {tscale})
+    {{}}
+
+    static {fn} _instance;
+
+}};
+
+
+
+""".format(**merge(vars(self), {"fn":fn})))
+
+        of.close()
+    #---------------------------------------------------------------------------------------------------------------------------
+    #
+    # Knots for KnotLookup1D over tmin..tmax. Each segment is pushed out
+    # a count at a time until the integer lookup, rounded slope and all,
+    # is more than tolerance C from the Beta equation at some count.
+    #
+    def genKnots(self):
+        c0 = self.countsAtTemp(self.tmin)
+        c1 = self.countsAtTemp(self.tmax)
+        c0, c1 = max(min(c0, c1), 1), min(max(c0, c1), self.ADCMAX-1)
+        vmax = (1<<15)-1 if self.type=="int16_t" else (1<<7)-1
+
+        value = dict((c, int(self.tempForCounts(c)*self.tscale+0.5)) for c in range(c0, c1+1))
+        maxslope = max(abs(value[c+1]-value[c]) for c in range(c0, c1))
+        self.slopebits = 0
+        while maxslope*(1<<(self.slopebits+1)) < vmax:
+            self.slopebits += 1
+
+        def slope(s, e):
+            return int(round((value[e]-value[s])*(1<<self.slopebits)/(e-s)))
+
+        def fits(s, e):
+            sl = slope(s, e)
+            half = 1 << self.slopebits >> 1
+            for c in range(s, e+1):
+                v = value[s] + ((sl*(c-s)+half) >> self.slopebits)
+                if abs(v/self.tscale - self.tempForCounts(c)) > self.tolerance:
+                    return False
+            return True
+
+        knots = [c0]
+        while knots[-1] < c1:
+            s = knots[-1]
+            e = s+1
+            while e < c1 and fits(s, e+1):
+                e += 1
+            knots.append(e)
+
+        self.knots = [(c, value[c], slope(c, n)) for c, n in zip(knots, knots[1:])] + [(c1, value[c1], 0)]
+        self.nknots = len(self.knots)
+
+        # index cell j starts at the last knot at or below j<<shift
+        shift = self.adcbits-self.ibits
+        self.index = []
+        for j in range(0, 1<<self.ibits):
+            i = 0
+            while i < self.nknots-2 and knots[i+1] <= j<<shift:
+                i += 1
+            self.index.append(i)
+        self.steps = max(sum(1 for k in knots if j<<shift < k < (j+1)<<shift) for j in range(0, 1<<self.ibits))
+    #---------------------------------------------------------------------------------------------------------------------------
+    def genKnotTable(self, fn):
+        print("knot table:",fn)
+        of = open(fn+".cpp","w")
+        of.write("""
+/**
+ @file
+   AUTOGENERATED Thermistor table, non-uniform knots
+
+   Rth          = {rthstr}
+   {model}
+   Rload        = {rlstr}
+   Inverted     = {invert}
+   ADC bits     = {adcbits}
+   Range        = {tmin}C to {tmax}C
+   Tolerance    = {tolerance}C
+   Knots        = {nknots}
+   Index bits   = {ibits}
+   Slope bits   = {slopebits}
+   Temp Scaled  = x{tscale}
+ */
+
+
+#include "{fn}.h"
+
+
+const KnotEntry<{type}> {fn}::_knots[] = {{
+""".format(**merge(vars(self), {"fn":fn})))
+
+        for i, (c, v, sl) in enumerate(self.knots):
+          of.write("  {{ {0:5d}, {1:8d}, {2:6d} }}, // #{3} t={4:.2f}C\n".format(c, v, sl, i, self.tempForCounts(c)))
+
+        of.write("""
+}};
+
+const uint8_t {fn}::_index[] = {{
+""".format(fn=fn))
+
+        for j, i in enumerate(self.index):
+          of.write("  {0:3d}, // c={1}\n".format(i, j<<(self.adcbits-self.ibits)))
+
+        of.write("""
+\n}};
+
+// static instance
+{fn} {fn}::_instance;
+
+""".format(**vars()));
+
+        of.close()
+    #---------------------------------------------------------------------------------------------------------------------------
+    def genKnotHeader(self,fn):
+        print("header:",fn)
+        of = open(fn+".h","w")
+        of.write("""
+/**
+ @file
+   AUTOGENERATED Thermistor table, non-uniform knots
+
+   Rth          = {rthstr}
+   {model}
+   Rload        = {rlstr}
+   Inverted     = {invert}
+   ADC bits     = {adcbits}
+   Range        = {tmin}C to {tmax}C
+   Tolerance    = {tolerance}C
+   Knots        = {nknots}
+   Index bits   = {ibits}
+   Slope bits   = {slopebits}
+   Temp Scaled  = x{tscale}
+ */
+#include "KnotLookup.h"
+
+class {fn} : public KnotLookup1D<{type}, {rtype}, {adcbits}, {nknots}, {ibits}, {steps}, {slopebits}>
+{{
+    typedef KnotLookup1D<{type}, {rtype}, {adcbits}, {nknots}, {ibits}, {steps}, {slopebits}> Base;
+
+    static const KnotEntry<{type}> _knots[];
+    static const uint8_t _index[];
+
+public:
+    {fn}() : Base(_knots, _index, {tscale})
+    {{}}
+
+    static {fn} _instance;
+
+}};
+
+
+
+""".format(**merge(vars(self), {"fn":fn})))
+
+        of.close()
+    #---------------------------------------------------------------------------------------------------------------------------
     def generate(self, fn=None):
       if fn==None:
-        
-        self.fn = fn = "TempTable{0}B{1}{2}x{3}".format( fmtshort(self.Rth),self.B,self.itext, self.tscale)        
-        self.genTable(fn)
-        self.genHeader(fn)
+
+        suffix = {"slope":"Slope", "direct":"Direct", "knots":"Knots"}.get(self.layout, "")
+        model = "SH" if self.sh else "B{0}".format(self.B)
+        self.fn = fn = "TempTable{0}{1}{2}x{3}{4}".format( fmtshort(self.Rth),model,self.itext, self.tscale, suffix)
+        if self.layout=="slope":
+            self.genSlopeTable(fn)
+            self.genSlopeHeader(fn)
+        elif self.layout=="direct":
+            self.genDirectTable(fn)
+            self.genDirectHeader(fn)
+        elif self.layout=="knots":
+            self.genKnots()
+            self.genKnotTable(fn)
+            self.genKnotHeader(fn)
+        else:
+            self.genTable(fn)
+            self.genHeader(fn)
         
         
     #---------------------------------------------------------------------------------------------------------------------------    
@@ -229,4 +585,13 @@ if __name__=="__main__":
   t.generate()  
   
   t = TabGen(100000,3950,100000,10,5, tscale=128)
-  t.generate()
\ No newline at end of file
+  t.generate()
+
+  t = TabGen(100000,3950,100000,10,5, tscale=128, layout="slope")
+  t.generate()
+
+  t = TabGen(100000,3950,100000,10,5, tscale=128, layout="knots")
+  t.generate()
+
+  # ThermistorTable.h builds these tables at compile time instead, e.g.
+  #   TempTable<100000, 3950, 100000, 10, 5, false, 128>
\ No newline at end of file